@@ -0,0 +1,108 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebenginecapturedframe.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineCapturedFramePrivate : public QSharedData
+{
+public:
+    QImage image;
+    QRegion damage;
+    qint64 timestamp = 0;
+};
+
+/*!
+    \class QWebEngineCapturedFrame
+    \brief A frame produced by the compositor of a web page.
+    \inmodule QtWebEngineCore
+    \since 6.10
+
+    Captured frames are delivered by QWebEnginePage::frameCaptured() after
+    QWebEnginePage::startFrameCapture() was called.
+
+    The image is a copy of the compositor's output owned by the capture, so
+    keeping it does not hold on to the compositor's buffers. It shares its
+    memory with the capture until the next frame is produced, at which point
+    the capture copies the whole image once if the application still holds
+    on to it.
+
+    \sa QWebEnginePage::startFrameCapture()
+*/
+
+/*! \internal
+*/
+QWebEngineCapturedFrame::QWebEngineCapturedFrame()
+    : d(new QWebEngineCapturedFramePrivate)
+{}
+
+/*! \internal
+*/
+QWebEngineCapturedFrame::QWebEngineCapturedFrame(const QImage &image, const QRegion &damage,
+                                                 qint64 timestamp)
+    : d(new QWebEngineCapturedFramePrivate)
+{
+    d->image = image;
+    d->damage = damage;
+    d->timestamp = timestamp;
+}
+
+/*! \internal
+*/
+QWebEngineCapturedFrame::QWebEngineCapturedFrame(const QWebEngineCapturedFrame &other) = default;
+
+/*! \internal
+*/
+QWebEngineCapturedFrame &
+QWebEngineCapturedFrame::operator=(const QWebEngineCapturedFrame &other) = default;
+
+/*! \internal
+*/
+QWebEngineCapturedFrame::~QWebEngineCapturedFrame() = default;
+
+/*!
+    Returns \c true if the frame holds no image.
+*/
+bool QWebEngineCapturedFrame::isNull() const
+{
+    return d->image.isNull();
+}
+
+/*!
+    \property QWebEngineCapturedFrame::image
+    \brief The frame contents in device pixels.
+*/
+QImage QWebEngineCapturedFrame::image() const
+{
+    return d->image;
+}
+
+/*!
+    \property QWebEngineCapturedFrame::damage
+    \brief The region of the image that changed since the previously
+    delivered frame, in device pixels.
+
+    This covers the whole image for the first frame and after the size
+    of the page changed.
+*/
+QRegion QWebEngineCapturedFrame::damage() const
+{
+    return d->damage;
+}
+
+/*!
+    \property QWebEngineCapturedFrame::timestamp
+    \brief The time the frame was produced, in microseconds of a monotonic
+    clock.
+
+    Only the difference between timestamps of frames is meaningful.
+*/
+qint64 QWebEngineCapturedFrame::timestamp() const
+{
+    return d->timestamp;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qwebenginecapturedframe.cpp"
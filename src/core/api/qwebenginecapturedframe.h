@@ -0,0 +1,46 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINECAPTUREDFRAME_H
+#define QWEBENGINECAPTUREDFRAME_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+
+#include <QtCore/qobject.h>
+#include <QtCore/qshareddata.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qregion.h>
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineCapturedFramePrivate;
+
+class Q_WEBENGINECORE_EXPORT QWebEngineCapturedFrame
+{
+    Q_GADGET
+    Q_PROPERTY(QImage image READ image CONSTANT FINAL)
+    Q_PROPERTY(QRegion damage READ damage CONSTANT FINAL)
+    Q_PROPERTY(qint64 timestamp READ timestamp CONSTANT FINAL)
+
+public:
+    QWebEngineCapturedFrame();
+    QWebEngineCapturedFrame(const QWebEngineCapturedFrame &other);
+    QWebEngineCapturedFrame &operator=(const QWebEngineCapturedFrame &other);
+    ~QWebEngineCapturedFrame();
+
+    bool isNull() const;
+    QImage image() const;
+    QRegion damage() const;
+    qint64 timestamp() const;
+
+private:
+    QWebEngineCapturedFrame(const QImage &image, const QRegion &damage, qint64 timestamp);
+
+    QSharedDataPointer<QWebEngineCapturedFramePrivate> d;
+
+    friend class QWebEnginePage;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINECAPTUREDFRAME_H
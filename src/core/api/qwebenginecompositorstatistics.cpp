@@ -0,0 +1,125 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebenginecompositorstatistics.h"
+
+#include "compositor/compositor.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineCompositorStatisticsPrivate : public QSharedData
+{
+public:
+    QtWebEngineCore::FrameStatistics statistics;
+};
+
+/*!
+    \class QWebEngineCompositorStatistics
+    \brief A snapshot of the compositor frame counters of a web page.
+    \inmodule QtWebEngineCore
+    \since 6.10
+
+    Contains the number of frames the page's compositor produced, presented
+    to the Qt scene graph and dropped, along with the latency between a frame
+    being produced and presented, and the accumulated damaged area.
+
+    Comparing produced and presented frames tells whether frames are lost
+    between Chromium's compositor and Qt. High present latency indicates that
+    the Qt side does not pick up frames in time.
+
+    \sa QWebEnginePage::compositorStatistics(), QWebEnginePage::resetCompositorStatistics()
+*/
+
+/*! \internal
+*/
+QWebEngineCompositorStatistics::QWebEngineCompositorStatistics()
+    : d(new QWebEngineCompositorStatisticsPrivate)
+{}
+
+/*! \internal
+*/
+QWebEngineCompositorStatistics::QWebEngineCompositorStatistics(
+        const QtWebEngineCore::FrameStatistics &statistics)
+    : d(new QWebEngineCompositorStatisticsPrivate)
+{
+    d->statistics = statistics;
+}
+
+/*! \internal
+*/
+QWebEngineCompositorStatistics::QWebEngineCompositorStatistics(
+        const QWebEngineCompositorStatistics &other) = default;
+
+/*! \internal
+*/
+QWebEngineCompositorStatistics &
+QWebEngineCompositorStatistics::operator=(const QWebEngineCompositorStatistics &other) = default;
+
+/*! \internal
+*/
+QWebEngineCompositorStatistics::~QWebEngineCompositorStatistics() = default;
+
+/*!
+    \property QWebEngineCompositorStatistics::framesProduced
+    \brief The number of frames the compositor finished drawing.
+*/
+quint64 QWebEngineCompositorStatistics::framesProduced() const
+{
+    return d->statistics.framesProduced;
+}
+
+/*!
+    \property QWebEngineCompositorStatistics::framesPresented
+    \brief The number of frames handed over to the Qt scene graph.
+*/
+quint64 QWebEngineCompositorStatistics::framesPresented() const
+{
+    return d->statistics.framesPresented;
+}
+
+/*!
+    \property QWebEngineCompositorStatistics::framesDropped
+    \brief The number of produced frames that were replaced by a newer frame
+    before being presented.
+*/
+quint64 QWebEngineCompositorStatistics::framesDropped() const
+{
+    return d->statistics.framesDropped;
+}
+
+/*!
+    \property QWebEngineCompositorStatistics::averagePresentLatency
+    \brief The average time in microseconds between a frame being produced
+    and presented.
+*/
+qint64 QWebEngineCompositorStatistics::averagePresentLatency() const
+{
+    const QtWebEngineCore::FrameStatistics &statistics = d->statistics;
+    return statistics.framesPresented
+            ? statistics.totalPresentLatency / qint64(statistics.framesPresented)
+            : 0;
+}
+
+/*!
+    \property QWebEngineCompositorStatistics::maximumPresentLatency
+    \brief The longest time in microseconds between a frame being produced
+    and presented.
+*/
+qint64 QWebEngineCompositorStatistics::maximumPresentLatency() const
+{
+    return d->statistics.maxPresentLatency;
+}
+
+/*!
+    \property QWebEngineCompositorStatistics::damagedPixelArea
+    \brief The accumulated area in pixels of the damaged regions of all
+    produced frames.
+*/
+quint64 QWebEngineCompositorStatistics::damagedPixelArea() const
+{
+    return d->statistics.damagedPixelArea;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qwebenginecompositorstatistics.cpp"
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINECOMPOSITORSTATISTICS_H
+#define QWEBENGINECOMPOSITORSTATISTICS_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+
+#include <QtCore/qobject.h>
+#include <QtCore/qshareddata.h>
+
+namespace QtWebEngineCore {
+struct FrameStatistics;
+}
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineCompositorStatisticsPrivate;
+
+class Q_WEBENGINECORE_EXPORT QWebEngineCompositorStatistics
+{
+    Q_GADGET
+    Q_PROPERTY(quint64 framesProduced READ framesProduced CONSTANT FINAL)
+    Q_PROPERTY(quint64 framesPresented READ framesPresented CONSTANT FINAL)
+    Q_PROPERTY(quint64 framesDropped READ framesDropped CONSTANT FINAL)
+    Q_PROPERTY(qint64 averagePresentLatency READ averagePresentLatency CONSTANT FINAL)
+    Q_PROPERTY(qint64 maximumPresentLatency READ maximumPresentLatency CONSTANT FINAL)
+    Q_PROPERTY(quint64 damagedPixelArea READ damagedPixelArea CONSTANT FINAL)
+
+public:
+    QWebEngineCompositorStatistics();
+    QWebEngineCompositorStatistics(const QWebEngineCompositorStatistics &other);
+    QWebEngineCompositorStatistics &operator=(const QWebEngineCompositorStatistics &other);
+    ~QWebEngineCompositorStatistics();
+
+    quint64 framesProduced() const;
+    quint64 framesPresented() const;
+    quint64 framesDropped() const;
+    qint64 averagePresentLatency() const;
+    qint64 maximumPresentLatency() const;
+    quint64 damagedPixelArea() const;
+
+private:
+    explicit QWebEngineCompositorStatistics(const QtWebEngineCore::FrameStatistics &statistics);
+
+    QSharedDataPointer<QWebEngineCompositorStatisticsPrivate> d;
+
+    friend class QWebEnginePage;
+    friend class QQuickWebEngineView;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINECOMPOSITORSTATISTICS_H
@@ -7,6 +7,7 @@
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 
 #include "net/cookie_monster_delegate_qt.h"
+#include "net/cookie_policy_qt.h"
 
 #include <QByteArray>
 #include <QUrl>
@@ -54,6 +55,8 @@ void QWebEngineCookieStorePrivate::processPendingUserCookies()
 
     if (bool(filterCallback))
         delegate->setHasFilter(true);
+    if (cookiePolicy)
+        delegate->setCookiePolicy(cookiePolicy);
 
     if (m_pendingUserCookies.isEmpty())
         return;
@@ -147,10 +150,31 @@ bool QWebEngineCookieStorePrivate::canAccessCookies(const QUrl &firstPartyUrl, c
                                                                 toGurl(firstPartyUrl),
                                                                 net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
+    return canAccessCookies(firstPartyUrl, url, thirdParty);
+}
+
+bool QWebEngineCookieStorePrivate::canAccessCookies(const QUrl &firstPartyUrl, const QUrl &url,
+                                                    bool thirdParty) const
+{
+    if (!filterCallback)
+        return true;
+
     QWebEngineCookieStore::FilterRequest request = { firstPartyUrl, url, thirdParty, false, 0 };
     return filterCallback(request);
 }
 
+void QWebEngineCookieStorePrivate::updateCookiePolicy()
+{
+    auto policy = std::make_shared<const CookiePolicyQt>(blockThirdPartyCookies,
+                                                         allowedCookieDomains,
+                                                         blockedCookieDomains);
+    if (policy->isEmpty())
+        policy.reset();
+    cookiePolicy = policy;
+    if (delegate)
+        delegate->setCookiePolicy(std::move(policy));
+}
+
 /*!
     \class QWebEngineCookieStore
     \inmodule QtWebEngineCore
@@ -297,6 +321,10 @@ void QWebEngineCookieStore::deleteAllCookies()
     those of cookies; including IndexedDB, DOM storage, filesystem API, service workers,
     and AppCache.
 
+    For common policies, such as blocking third-party cookies, prefer
+    setThirdPartyCookiesBlocked(), setAllowedCookieDomains() and setBlockedCookieDomains(),
+    which are evaluated without calling the filter.
+
     \sa deleteAllCookies(), loadAllCookies()
 */
 void QWebEngineCookieStore::setCookieFilter(const std::function<bool(const FilterRequest &)> &filterCallback)
@@ -319,6 +347,104 @@ void QWebEngineCookieStore::setCookieFilter(std::function<bool(const FilterReque
         d_ptr->delegate->setHasFilter(bool(d_ptr->filterCallback));
 }
 
+/*!
+    \since 6.10
+
+    Returns whether third-party cookie access is blocked.
+
+    \sa setThirdPartyCookiesBlocked()
+*/
+bool QWebEngineCookieStore::thirdPartyCookiesBlocked() const
+{
+    return d_ptr->blockThirdPartyCookies;
+}
+
+/*!
+    \since 6.10
+
+    Sets whether sites and resources are prevented from using cookies in a
+    third-party context to \a blocked. The default is \c false.
+
+    An access is third-party under the same rules as FilterRequest::thirdParty.
+    Domains in allowedCookieDomains() are exempt.
+
+    Unlike a filter installed with setCookieFilter(), the cookie policy set up
+    by this function, setAllowedCookieDomains() and setBlockedCookieDomains() is
+    evaluated without calling into the application, and its decisions are cached
+    per pair of hosts. This matters on pages that access cookies hundreds of times
+    while loading. The cookie filter is only called for accesses the policy leaves
+    undecided: those from domains in neither list that are first-party, or
+    third-party while third-party cookies are not blocked.
+
+    \note Like the cookie filter, the policy also controls IndexedDB, DOM storage
+    and other features with tracking capabilities similar to those of cookies.
+
+    \sa setAllowedCookieDomains(), setBlockedCookieDomains(), setCookieFilter()
+*/
+void QWebEngineCookieStore::setThirdPartyCookiesBlocked(bool blocked)
+{
+    if (d_ptr->blockThirdPartyCookies == blocked)
+        return;
+    d_ptr->blockThirdPartyCookies = blocked;
+    d_ptr->updateCookiePolicy();
+}
+
+/*!
+    \since 6.10
+
+    Returns the domains that are always allowed to use cookies.
+
+    \sa setAllowedCookieDomains()
+*/
+QStringList QWebEngineCookieStore::allowedCookieDomains() const
+{
+    return d_ptr->allowedCookieDomains;
+}
+
+/*!
+    \since 6.10
+
+    Allows sites and resources on one of \a domains, or their subdomains, to use
+    cookies even in a third-party context and without consulting the cookie filter.
+    \c{example.com} also covers \c{www.example.com}.
+
+    Domains in blockedCookieDomains() take precedence.
+
+    \sa setThirdPartyCookiesBlocked(), setBlockedCookieDomains()
+*/
+void QWebEngineCookieStore::setAllowedCookieDomains(const QStringList &domains)
+{
+    d_ptr->allowedCookieDomains = domains;
+    d_ptr->updateCookiePolicy();
+}
+
+/*!
+    \since 6.10
+
+    Returns the domains that are never allowed to use cookies.
+
+    \sa setBlockedCookieDomains()
+*/
+QStringList QWebEngineCookieStore::blockedCookieDomains() const
+{
+    return d_ptr->blockedCookieDomains;
+}
+
+/*!
+    \since 6.10
+
+    Prevents sites and resources on one of \a domains, or their subdomains, from
+    using cookies, whether in a first-party or a third-party context, and without
+    consulting the cookie filter.
+
+    \sa setThirdPartyCookiesBlocked(), setAllowedCookieDomains()
+*/
+void QWebEngineCookieStore::setBlockedCookieDomains(const QStringList &domains)
+{
+    d_ptr->blockedCookieDomains = domains;
+    d_ptr->updateCookiePolicy();
+}
+
 /*!
     \class QWebEngineCookieStore::FilterRequest
     \inmodule QtWebEngineCore
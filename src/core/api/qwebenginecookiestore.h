@@ -8,6 +8,7 @@
 
 #include <QtCore/qobject.h>
 #include <QtCore/qscopedpointer.h>
+#include <QtCore/qstringlist.h>
 #include <QtCore/qurl.h>
 #include <QtNetwork/qnetworkcookie.h>
 
@@ -38,6 +39,12 @@ public:
 
     void setCookieFilter(const std::function<bool(const FilterRequest &)> &filterCallback);
     void setCookieFilter(std::function<bool(const FilterRequest &)> &&filterCallback);
+    void setThirdPartyCookiesBlocked(bool blocked);
+    bool thirdPartyCookiesBlocked() const;
+    void setAllowedCookieDomains(const QStringList &domains);
+    QStringList allowedCookieDomains() const;
+    void setBlockedCookieDomains(const QStringList &domains);
+    QStringList blockedCookieDomains() const;
     void setCookie(const QNetworkCookie &cookie, const QUrl &origin = QUrl());
     void deleteCookie(const QNetworkCookie &cookie, const QUrl &origin = QUrl());
     void deleteSessionCookies();
@@ -21,10 +21,14 @@
 
 #include <QList>
 #include <QNetworkCookie>
+#include <QStringList>
 #include <QUrl>
 
+#include <memory>
+
 namespace QtWebEngineCore {
 class CookieMonsterDelegateQt;
+class CookiePolicyQt;
 }
 
 QT_BEGIN_NAMESPACE
@@ -42,6 +46,10 @@ class Q_WEBENGINECORE_EXPORT QWebEngineCookieStorePrivate
 
 public:
     std::function<bool(const QWebEngineCookieStore::FilterRequest &)> filterCallback;
+    bool blockThirdPartyCookies = false;
+    QStringList allowedCookieDomains;
+    QStringList blockedCookieDomains;
+    std::shared_ptr<const QtWebEngineCore::CookiePolicyQt> cookiePolicy;
     QList<CookieData> m_pendingUserCookies;
     bool m_deleteSessionCookiesPending;
     bool m_deleteAllCookiesPending;
@@ -59,7 +67,9 @@ public:
     void deleteAllCookies();
     void getAllCookies();
 
+    void updateCookiePolicy();
     bool canAccessCookies(const QUrl &firstPartyUrl, const QUrl &url) const;
+    bool canAccessCookies(const QUrl &firstPartyUrl, const QUrl &url, bool thirdParty) const;
 
     void onCookieChanged(const QNetworkCookie &cookie, bool removed);
 };
@@ -29,7 +29,13 @@ QT_BEGIN_NAMESPACE
 
     Invoke setDnsMode() to configure DNS-over-HTTPS.
 
-    \sa QWebEngineGlobalSettings::setDnsMode()
+    Invoke setWorkBudget() to configure how long the web engine may run its
+    tasks on the UI thread before returning control to the Qt event loop.
+
+    Invoke messagePumpStatistics() to find out how these tasks and the Qt event
+    loop share the UI thread.
+
+    \sa QWebEngineGlobalSettings::setDnsMode(), QWebEngineGlobalSettings::setWorkBudget()
 */
 
 /*!
@@ -108,6 +114,112 @@ bool QWebEngineGlobalSettings::setDnsMode(DnsMode dnsMode)
     return true;
 }
 
+/*!
+    \class QWebEngineGlobalSettings::WorkBudget
+    \brief The WorkBudget struct specifies how long the web engine may run on the UI thread
+    without yielding.
+    \since 6.10
+    \inmodule QtWebEngineCore
+
+    The web engine runs part of its tasks on the thread of the Qt event loop. It runs
+    them in slices, and between two slices the Qt event loop processes its own events,
+    such as input events, timers, and the synchronization of Qt Quick scenes.
+
+    By default, a slice lasts 2 milliseconds. When an application sets bounds with
+    QWebEngineGlobalSettings::setWorkBudget() that differ from each other, the length
+    of a slice adapts to how busy the Qt side is. It shrinks to \l minimum when input
+    events are waiting to be delivered, shrinks when the Qt event loop is slow to give
+    control back to the web engine, and grows up to \l maximum while the Qt event loop
+    is idle. A default-constructed WorkBudget enables the adaptation with the bounds
+    documented below.
+
+    Setting \l minimum and \l maximum to the same value disables the adaptation.
+*/
+
+/*!
+    \variable QWebEngineGlobalSettings::WorkBudget::minimum
+    \brief The shortest time the web engine runs its tasks before yielding.
+
+    The default value of this member is 500 microseconds.
+*/
+
+/*!
+    \variable QWebEngineGlobalSettings::WorkBudget::maximum
+    \brief The longest time the web engine runs its tasks before yielding.
+
+    The default value of this member is 8 milliseconds.
+*/
+
+/*!
+    \fn bool QWebEngineGlobalSettings::setWorkBudget(WorkBudget workBudget)
+    \since 6.10
+
+    Sets \a workBudget as the bounds for running web engine tasks on the UI thread.
+
+    This function returns \c false and leaves the current budget unchanged if
+    \l {QWebEngineGlobalSettings::WorkBudget::minimum}{minimum} is not positive or is
+    greater than \l {QWebEngineGlobalSettings::WorkBudget::maximum}{maximum}.
+    Otherwise, it returns \c true and the budget applies from the next slice on.
+
+    This function must be called from the UI thread.
+
+    \sa workBudget()
+*/
+
+bool QWebEngineGlobalSettings::setWorkBudget(WorkBudget workBudget)
+{
+    if (workBudget.minimum <= std::chrono::microseconds::zero()
+        || workBudget.minimum > workBudget.maximum)
+        return false;
+    QWebEngineGlobalSettingsPrivate::instance()->workBudget = workBudget;
+    return true;
+}
+
+/*!
+    \fn QWebEngineGlobalSettings::WorkBudget QWebEngineGlobalSettings::workBudget()
+    \since 6.10
+
+    Returns the bounds for running web engine tasks on the UI thread.
+
+    Unless setWorkBudget() was called, both bounds are 2 milliseconds.
+
+    \sa setWorkBudget()
+*/
+
+QWebEngineGlobalSettings::WorkBudget QWebEngineGlobalSettings::workBudget()
+{
+    return QWebEngineGlobalSettingsPrivate::instance()->workBudget;
+}
+
+/*!
+    \fn QWebEngineMessagePumpStatistics QWebEngineGlobalSettings::messagePumpStatistics()
+    \since 6.10
+
+    Returns the counters of the web engine tasks run on the UI thread since the
+    application started or since the last call to resetMessagePumpStatistics().
+
+    This function must be called from the UI thread.
+*/
+
+QWebEngineMessagePumpStatistics QWebEngineGlobalSettings::messagePumpStatistics()
+{
+    return QWebEngineGlobalSettingsPrivate::instance()->messagePumpStatisticsSnapshot();
+}
+
+/*!
+    \fn void QWebEngineGlobalSettings::resetMessagePumpStatistics()
+    \since 6.10
+
+    Resets the counters returned by messagePumpStatistics().
+
+    This function must be called from the UI thread.
+*/
+
+void QWebEngineGlobalSettings::resetMessagePumpStatistics()
+{
+    QWebEngineGlobalSettingsPrivate::instance()->messagePumpStatistics = {};
+}
+
 /*!
     \internal
 */
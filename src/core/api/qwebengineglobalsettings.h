@@ -9,9 +9,12 @@
 #endif
 
 #include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebenginemessagepumpstatistics.h>
 #include <QtCore/QObject>
 #include <QtCore/QScopedPointer>
 
+#include <chrono>
+
 QT_BEGIN_NAMESPACE
 
 namespace QWebEngineGlobalSettings {
@@ -23,6 +26,17 @@ struct DnsMode
     QStringList serverTemplates;
 };
 Q_WEBENGINECORE_EXPORT bool setDnsMode(DnsMode dnsMode);
+
+struct WorkBudget
+{
+    std::chrono::microseconds minimum = std::chrono::microseconds(500);
+    std::chrono::microseconds maximum = std::chrono::milliseconds(8);
+};
+Q_WEBENGINECORE_EXPORT bool setWorkBudget(WorkBudget workBudget);
+Q_WEBENGINECORE_EXPORT WorkBudget workBudget();
+
+Q_WEBENGINECORE_EXPORT QWebEngineMessagePumpStatistics messagePumpStatistics();
+Q_WEBENGINECORE_EXPORT void resetMessagePumpStatistics();
 }
 
 QT_END_NAMESPACE
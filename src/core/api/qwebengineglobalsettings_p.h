@@ -17,8 +17,28 @@
 
 #include "qtwebenginecoreglobal_p.h"
 #include "qwebengineglobalsettings.h"
+#include "qwebenginemessagepumpstatistics.h"
+#include <array>
 #include <string>
 
+namespace QtWebEngineCore {
+// Counters of the UI thread message pump, updated on the UI thread.
+struct MessagePumpStatistics
+{
+    static constexpr int kHistogramBuckets = 8;
+
+    quint64 slices = 0;
+    quint64 expiredSlices = 0;
+    quint64 workIterations = 0;
+    qint64 workTime = 0; // in microseconds
+    qint64 idleWorkTime = 0; // in microseconds
+    qint64 totalQueueDelay = 0; // in microseconds
+    qint64 maxQueueDelay = 0; // in microseconds
+    std::array<quint64, kHistogramBuckets> queueDelayHistogram = {};
+    std::array<quint64, kHistogramBuckets> workIterationsHistogram = {};
+};
+} // namespace QtWebEngineCore
+
 QT_BEGIN_NAMESPACE
 
 class Q_WEBENGINECORE_EXPORT QWebEngineGlobalSettingsPrivate
@@ -35,6 +55,17 @@ public:
     std::string dnsOverHttpsTemplates;
     const bool insecureDnsClientEnabled;
     const bool additionalInsecureDnsTypesEnabled;
+    // A fixed slice unless the application opts into adaptation with setWorkBudget().
+    QWebEngineGlobalSettings::WorkBudget workBudget = { std::chrono::milliseconds(2),
+                                                        std::chrono::milliseconds(2) };
+    // Length of the slice the UI message pump used last, updated on the UI thread.
+    std::chrono::nanoseconds currentWorkBudget = std::chrono::milliseconds(2);
+    QtWebEngineCore::MessagePumpStatistics messagePumpStatistics;
+
+    QWebEngineMessagePumpStatistics messagePumpStatisticsSnapshot() const
+    {
+        return QWebEngineMessagePumpStatistics(messagePumpStatistics);
+    }
 
     void configureStubHostResolver();
 };
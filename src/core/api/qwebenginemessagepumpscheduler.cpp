@@ -3,36 +3,146 @@
 
 #include "qwebenginemessagepumpscheduler_p.h"
 
-#include <QAbstractEventDispatcher>
 #include <QCoreApplication>
 #include <QTimerEvent>
 
+#if defined(Q_OS_LINUX)
+#include <QSocketNotifier>
+
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
 QWebEngineMessagePumpScheduler::QWebEngineMessagePumpScheduler(std::function<void()> callback)
     : m_callback(std::move(callback))
-{}
+{
+#if defined(Q_OS_LINUX)
+    // Waking up through file descriptors watched by the event dispatcher bypasses
+    // the posted event queue, and timerfd has a better than millisecond precision.
+    m_eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (m_eventFd < 0 || m_timerFd < 0) {
+        qWarning("Could not create message pump file descriptors, falling back to timer events.");
+        if (m_eventFd >= 0)
+            close(m_eventFd);
+        if (m_timerFd >= 0)
+            close(m_timerFd);
+        m_eventFd = m_timerFd = -1;
+        return;
+    }
 
+    m_eventNotifier = new QSocketNotifier(m_eventFd, QSocketNotifier::Read, this);
+    connect(m_eventNotifier, &QSocketNotifier::activated, this, [this]() {
+        eventfd_t value;
+        if (eventfd_read(m_eventFd, &value) == 0)
+            runImmediateWork();
+    });
+    m_timerNotifier = new QSocketNotifier(m_timerFd, QSocketNotifier::Read, this);
+    connect(m_timerNotifier, &QSocketNotifier::activated, this, [this]() {
+        // Reading fails when the timer was rearmed or disarmed after it expired.
+        uint64_t expirations;
+        if (read(m_timerFd, &expirations, sizeof(expirations)) == sizeof(expirations))
+            runDelayedWork();
+    });
+#endif
+}
+
+QWebEngineMessagePumpScheduler::~QWebEngineMessagePumpScheduler()
+{
+#if defined(Q_OS_LINUX)
+    if (m_eventFd >= 0) {
+        delete m_eventNotifier;
+        delete m_timerNotifier;
+        close(m_eventFd);
+        close(m_timerFd);
+    }
+#endif
+}
+
+// May be called from any thread.
 void QWebEngineMessagePumpScheduler::scheduleImmediateWork()
 {
+    if (!m_immediateWorkPending.testAndSetOrdered(0, 1))
+        return;
+
+    m_immediateWorkPostedAt.storeRelaxed(QDeadlineTimer::current().deadlineNSecs());
+#if defined(Q_OS_LINUX)
+    if (m_eventFd >= 0) {
+        eventfd_write(m_eventFd, 1);
+        return;
+    }
+#endif
     QCoreApplication::postEvent(this, new QTimerEvent(0), Qt::NormalEventPriority);
 }
 
-void QWebEngineMessagePumpScheduler::scheduleDelayedWork(int delay)
+void QWebEngineMessagePumpScheduler::scheduleDelayedWork(std::chrono::microseconds delay)
 {
-    if (delay < 0) {
-        killTimer(m_timerId);
-        m_timerId = 0;
-    } else if (!m_timerId || delay < QAbstractEventDispatcher::instance()->remainingTime(m_timerId)) {
-        killTimer(m_timerId);
-        m_timerId = startTimer(delay);
+    if (delay < std::chrono::microseconds::zero())
+        return cancelDelayedWork();
+
+    const QDeadlineTimer due(delay, Qt::PreciseTimer);
+    if (m_delayedWorkScheduled && !(due < m_delayedWorkDue))
+        return;
+    m_delayedWorkScheduled = true;
+    m_delayedWorkDue = due;
+
+#if defined(Q_OS_LINUX)
+    if (m_timerFd >= 0) {
+        // Arm with the absolute deadline, as a zero relative value would disarm the timer.
+        const qint64 deadline = due.deadlineNSecs();
+        itimerspec spec = {};
+        spec.it_value.tv_sec = deadline / 1000000000;
+        spec.it_value.tv_nsec = deadline % 1000000000;
+        timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+        return;
     }
+#endif
+    killTimer(m_timerId);
+    m_timerId = startTimer(std::chrono::ceil<std::chrono::milliseconds>(delay));
 }
 
-void QWebEngineMessagePumpScheduler::timerEvent(QTimerEvent *ev)
+void QWebEngineMessagePumpScheduler::cancelDelayedWork()
 {
-    Q_ASSERT(!ev->timerId() || m_timerId == ev->timerId());
+    m_delayedWorkScheduled = false;
+#if defined(Q_OS_LINUX)
+    if (m_timerFd >= 0) {
+        const itimerspec spec = {};
+        timerfd_settime(m_timerFd, 0, &spec, nullptr);
+        return;
+    }
+#endif
     killTimer(m_timerId);
     m_timerId = 0;
+}
+
+void QWebEngineMessagePumpScheduler::runImmediateWork()
+{
+    // Work scheduled from now on may not be seen by the callback, so it
+    // needs a new wakeup.
+    m_immediateWorkPending.fetchAndStoreOrdered(0);
+    m_queueDelay = std::chrono::nanoseconds(QDeadlineTimer::current().deadlineNSecs()
+                                            - m_immediateWorkPostedAt.loadRelaxed());
+    cancelDelayedWork();
     m_callback();
 }
 
+void QWebEngineMessagePumpScheduler::runDelayedWork()
+{
+    m_queueDelay = std::chrono::nanoseconds(
+            qMax(QDeadlineTimer::current().deadlineNSecs() - m_delayedWorkDue.deadlineNSecs(),
+                 qint64(0)));
+    cancelDelayedWork();
+    m_callback();
+}
+
+void QWebEngineMessagePumpScheduler::timerEvent(QTimerEvent *ev)
+{
+    Q_ASSERT(!ev->timerId() || m_timerId == ev->timerId());
+    if (!ev->timerId())
+        runImmediateWork();
+    else
+        runDelayedWork();
+}
+
 #include "moc_qwebenginemessagepumpscheduler_p.cpp"
@@ -17,25 +17,53 @@
 
 #include "qtwebenginecoreglobal_p.h"
 
+#include <QtCore/qatomic.h>
+#include <QtCore/qdeadlinetimer.h>
 #include <QtCore/qobject.h>
 
+#include <chrono>
 #include <functional>
 
 QT_BEGIN_NAMESPACE
 
+class QSocketNotifier;
+
 class Q_WEBENGINECORE_EXPORT QWebEngineMessagePumpScheduler : public QObject
 {
     Q_OBJECT
 public:
     QWebEngineMessagePumpScheduler(std::function<void()> callback);
+    ~QWebEngineMessagePumpScheduler() override;
     void scheduleImmediateWork();
-    void scheduleDelayedWork(int delay);
+    // A negative delay cancels delayed work.
+    void scheduleDelayedWork(std::chrono::microseconds delay);
+    // How long the last callback waited in the Qt event loop after its work was due.
+    std::chrono::nanoseconds queueDelay() const { return m_queueDelay; }
 
 protected:
     void timerEvent(QTimerEvent *ev) override;
 
 private:
+    void cancelDelayedWork();
+    void runImmediateWork();
+    void runDelayedWork();
+
     int m_timerId = 0;
+#if defined(Q_OS_LINUX)
+    // When available, wakeups are signaled through these file descriptors
+    // instead of timer events.
+    int m_eventFd = -1;
+    int m_timerFd = -1;
+    QSocketNotifier *m_eventNotifier = nullptr;
+    QSocketNotifier *m_timerNotifier = nullptr;
+#endif
+    // Set while an immediate work wakeup is pending, so that bursts of
+    // scheduleImmediateWork() calls from any thread signal a single wakeup.
+    QAtomicInt m_immediateWorkPending;
+    QAtomicInteger<qint64> m_immediateWorkPostedAt;
+    bool m_delayedWorkScheduled = false;
+    QDeadlineTimer m_delayedWorkDue;
+    std::chrono::nanoseconds m_queueDelay = std::chrono::nanoseconds::zero();
     std::function<void()> m_callback;
 };
 
@@ -0,0 +1,163 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebenginemessagepumpstatistics.h"
+
+#include "qwebengineglobalsettings_p.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineMessagePumpStatisticsPrivate : public QSharedData
+{
+public:
+    QtWebEngineCore::MessagePumpStatistics statistics;
+};
+
+/*!
+    \class QWebEngineMessagePumpStatistics
+    \brief A snapshot of the counters of the web engine tasks run on the UI thread.
+    \inmodule QtWebEngineCore
+    \since 6.10
+
+    The web engine runs part of its tasks on the thread of the Qt event loop, in
+    slices bounded by QWebEngineGlobalSettings::WorkBudget. This class contains
+    the number of slices, how many of them ran out of time with tasks still
+    pending, the time spent in them, and how long the Qt event loop delayed them.
+
+    Many expired slices and a high work time indicate that web engine tasks keep
+    the Qt event loop busy. A high queue delay indicates that the Qt side does
+    not give the web engine a chance to run its tasks in time.
+
+    Setting the \c qt.webengine.messagepump logging category to debug level
+    additionally reports each expired slice and each long queue delay.
+
+    \sa QWebEngineGlobalSettings::messagePumpStatistics(),
+    QWebEngineGlobalSettings::resetMessagePumpStatistics()
+*/
+
+/*! \internal
+*/
+QWebEngineMessagePumpStatistics::QWebEngineMessagePumpStatistics()
+    : d(new QWebEngineMessagePumpStatisticsPrivate)
+{}
+
+/*! \internal
+*/
+QWebEngineMessagePumpStatistics::QWebEngineMessagePumpStatistics(
+        const QtWebEngineCore::MessagePumpStatistics &statistics)
+    : d(new QWebEngineMessagePumpStatisticsPrivate)
+{
+    d->statistics = statistics;
+}
+
+/*! \internal
+*/
+QWebEngineMessagePumpStatistics::QWebEngineMessagePumpStatistics(
+        const QWebEngineMessagePumpStatistics &other) = default;
+
+/*! \internal
+*/
+QWebEngineMessagePumpStatistics &
+QWebEngineMessagePumpStatistics::operator=(const QWebEngineMessagePumpStatistics &other) = default;
+
+/*! \internal
+*/
+QWebEngineMessagePumpStatistics::~QWebEngineMessagePumpStatistics() = default;
+
+/*!
+    \property QWebEngineMessagePumpStatistics::slices
+    \brief The number of times the web engine ran its tasks on the UI thread.
+*/
+quint64 QWebEngineMessagePumpStatistics::slices() const
+{
+    return d->statistics.slices;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::expiredSlices
+    \brief The number of slices that ran out of time while tasks were still pending.
+*/
+quint64 QWebEngineMessagePumpStatistics::expiredSlices() const
+{
+    return d->statistics.expiredSlices;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::workIterations
+    \brief The number of task batches run in all slices.
+*/
+quint64 QWebEngineMessagePumpStatistics::workIterations() const
+{
+    return d->statistics.workIterations;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::workTime
+    \brief The accumulated time in microseconds spent running tasks.
+*/
+qint64 QWebEngineMessagePumpStatistics::workTime() const
+{
+    return d->statistics.workTime;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::idleWorkTime
+    \brief The accumulated time in microseconds spent in idle work after the
+    tasks of a slice were done.
+*/
+qint64 QWebEngineMessagePumpStatistics::idleWorkTime() const
+{
+    return d->statistics.idleWorkTime;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::averageQueueDelay
+    \brief The average time in microseconds a slice waited in the Qt event loop
+    after its tasks were due.
+*/
+qint64 QWebEngineMessagePumpStatistics::averageQueueDelay() const
+{
+    const QtWebEngineCore::MessagePumpStatistics &statistics = d->statistics;
+    return statistics.slices ? statistics.totalQueueDelay / qint64(statistics.slices) : 0;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::maximumQueueDelay
+    \brief The longest time in microseconds a slice waited in the Qt event loop
+    after its tasks were due.
+*/
+qint64 QWebEngineMessagePumpStatistics::maximumQueueDelay() const
+{
+    return d->statistics.maxQueueDelay;
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::queueDelayHistogram
+    \brief The number of slices by queue delay.
+
+    The first bucket counts delays below one millisecond. Bucket \c i counts
+    delays from 2 to the power of \c{i - 1} milliseconds up to twice that, and
+    the last bucket counts all longer delays.
+*/
+QList<quint64> QWebEngineMessagePumpStatistics::queueDelayHistogram() const
+{
+    const auto &histogram = d->statistics.queueDelayHistogram;
+    return QList<quint64>(histogram.begin(), histogram.end());
+}
+
+/*!
+    \property QWebEngineMessagePumpStatistics::workIterationsHistogram
+    \brief The number of slices by the number of task batches they ran.
+
+    Bucket \c i counts slices that ran from 2 to the power of \c i batches up
+    to twice that, and the last bucket counts all larger slices.
+*/
+QList<quint64> QWebEngineMessagePumpStatistics::workIterationsHistogram() const
+{
+    const auto &histogram = d->statistics.workIterationsHistogram;
+    return QList<quint64>(histogram.begin(), histogram.end());
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qwebenginemessagepumpstatistics.cpp"
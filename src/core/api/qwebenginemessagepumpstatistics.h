@@ -0,0 +1,61 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEMESSAGEPUMPSTATISTICS_H
+#define QWEBENGINEMESSAGEPUMPSTATISTICS_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+
+#include <QtCore/qlist.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qshareddata.h>
+
+namespace QtWebEngineCore {
+struct MessagePumpStatistics;
+}
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineMessagePumpStatisticsPrivate;
+
+class Q_WEBENGINECORE_EXPORT QWebEngineMessagePumpStatistics
+{
+    Q_GADGET
+    Q_PROPERTY(quint64 slices READ slices CONSTANT FINAL)
+    Q_PROPERTY(quint64 expiredSlices READ expiredSlices CONSTANT FINAL)
+    Q_PROPERTY(quint64 workIterations READ workIterations CONSTANT FINAL)
+    Q_PROPERTY(qint64 workTime READ workTime CONSTANT FINAL)
+    Q_PROPERTY(qint64 idleWorkTime READ idleWorkTime CONSTANT FINAL)
+    Q_PROPERTY(qint64 averageQueueDelay READ averageQueueDelay CONSTANT FINAL)
+    Q_PROPERTY(qint64 maximumQueueDelay READ maximumQueueDelay CONSTANT FINAL)
+    Q_PROPERTY(QList<quint64> queueDelayHistogram READ queueDelayHistogram CONSTANT FINAL)
+    Q_PROPERTY(QList<quint64> workIterationsHistogram READ workIterationsHistogram CONSTANT FINAL)
+
+public:
+    QWebEngineMessagePumpStatistics();
+    QWebEngineMessagePumpStatistics(const QWebEngineMessagePumpStatistics &other);
+    QWebEngineMessagePumpStatistics &operator=(const QWebEngineMessagePumpStatistics &other);
+    ~QWebEngineMessagePumpStatistics();
+
+    quint64 slices() const;
+    quint64 expiredSlices() const;
+    quint64 workIterations() const;
+    qint64 workTime() const;
+    qint64 idleWorkTime() const;
+    qint64 averageQueueDelay() const;
+    qint64 maximumQueueDelay() const;
+    QList<quint64> queueDelayHistogram() const;
+    QList<quint64> workIterationsHistogram() const;
+
+private:
+    explicit QWebEngineMessagePumpStatistics(
+            const QtWebEngineCore::MessagePumpStatistics &statistics);
+
+    QSharedDataPointer<QWebEngineMessagePumpStatisticsPrivate> d;
+
+    friend class QWebEngineGlobalSettingsPrivate;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEMESSAGEPUMPSTATISTICS_H
@@ -0,0 +1,209 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebenginenetworkrequestrecord.h"
+
+#include "net/network_request_log.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineNetworkRequestRecordPrivate : public QSharedData
+{
+public:
+    QtWebEngineCore::NetworkRequestEntry entry;
+};
+
+/*!
+    \class QWebEngineNetworkRequestRecord
+    \brief Timings and sizes of a finished network request of a web page.
+    \inmodule QtWebEngineCore
+    \since 6.10
+
+    Records are delivered in batches by QWebEnginePage::networkRequestsFinished()
+    after QWebEnginePage::startNetworkRequestLog() was called. They carry the
+    phases of the request as measured by the network stack and the number of
+    bytes it transferred, which lets applications attribute bandwidth and slow
+    loads to pages without the developer tools.
+
+    Durations are in microseconds, and \c -1 when the phase did not happen,
+    for instance no DNS lookup or connection setup for a request served from
+    the cache or sent over a reused connection.
+
+    \sa QWebEnginePage::startNetworkRequestLog()
+*/
+
+/*! \internal
+*/
+QWebEngineNetworkRequestRecord::QWebEngineNetworkRequestRecord()
+    : d(new QWebEngineNetworkRequestRecordPrivate)
+{}
+
+/*! \internal
+*/
+QWebEngineNetworkRequestRecord::QWebEngineNetworkRequestRecord(
+        const QtWebEngineCore::NetworkRequestEntry &entry)
+    : d(new QWebEngineNetworkRequestRecordPrivate)
+{
+    d->entry = entry;
+}
+
+/*! \internal
+*/
+QWebEngineNetworkRequestRecord::QWebEngineNetworkRequestRecord(
+        const QWebEngineNetworkRequestRecord &other) = default;
+
+/*! \internal
+*/
+QWebEngineNetworkRequestRecord &
+QWebEngineNetworkRequestRecord::operator=(const QWebEngineNetworkRequestRecord &other) = default;
+
+/*! \internal
+*/
+QWebEngineNetworkRequestRecord::~QWebEngineNetworkRequestRecord() = default;
+
+/*!
+    \property QWebEngineNetworkRequestRecord::url
+    \brief The URL of the request, after any redirects.
+*/
+QUrl QWebEngineNetworkRequestRecord::url() const
+{
+    return d->entry.url;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::initiator
+    \brief The origin that started the request, or an empty URL for
+    navigations started by the application.
+*/
+QUrl QWebEngineNetworkRequestRecord::initiator() const
+{
+    return d->entry.initiator;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::resourceType
+    \brief The type of resource requested.
+*/
+QWebEngineUrlRequestInfo::ResourceType QWebEngineNetworkRequestRecord::resourceType() const
+{
+    return QWebEngineUrlRequestInfo::ResourceType(d->entry.resourceType);
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::statusCode
+    \brief The HTTP status code of the response, or \c 0 if there was none.
+*/
+int QWebEngineNetworkRequestRecord::statusCode() const
+{
+    return d->entry.statusCode;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::error
+    \brief The network error the request failed with, or \c 0 if it succeeded.
+
+    The values are Chromium's net error codes, such as \c -2 for a generic
+    failure or \c -3 for an aborted request.
+*/
+int QWebEngineNetworkRequestRecord::error() const
+{
+    return d->entry.error;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::fromCache
+    \brief Whether the response was served from the HTTP cache.
+*/
+bool QWebEngineNetworkRequestRecord::fromCache() const
+{
+    return d->entry.fromCache;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::dnsDuration
+    \brief The time spent resolving the host name.
+*/
+qint64 QWebEngineNetworkRequestRecord::dnsDuration() const
+{
+    return d->entry.dnsDuration;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::connectDuration
+    \brief The time spent establishing the connection, including the TLS
+    handshake.
+*/
+qint64 QWebEngineNetworkRequestRecord::connectDuration() const
+{
+    return d->entry.connectDuration;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::sslDuration
+    \brief The time spent in the TLS handshake.
+*/
+qint64 QWebEngineNetworkRequestRecord::sslDuration() const
+{
+    return d->entry.sslDuration;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::timeToFirstByte
+    \brief The time from the start of the request until the first byte of the
+    response headers arrived.
+*/
+qint64 QWebEngineNetworkRequestRecord::timeToFirstByte() const
+{
+    return d->entry.timeToFirstByte;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::downloadDuration
+    \brief The time from receiving the response headers until the request
+    completed.
+*/
+qint64 QWebEngineNetworkRequestRecord::downloadDuration() const
+{
+    return d->entry.downloadDuration;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::totalDuration
+    \brief The time from the start of the request until it completed.
+*/
+qint64 QWebEngineNetworkRequestRecord::totalDuration() const
+{
+    return d->entry.totalDuration;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::encodedDataLength
+    \brief The number of bytes received from the network, including headers.
+*/
+qint64 QWebEngineNetworkRequestRecord::encodedDataLength() const
+{
+    return d->entry.encodedDataLength;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::encodedBodyLength
+    \brief The number of bytes of the response body as received, before
+    content decoding.
+*/
+qint64 QWebEngineNetworkRequestRecord::encodedBodyLength() const
+{
+    return d->entry.encodedBodyLength;
+}
+
+/*!
+    \property QWebEngineNetworkRequestRecord::decodedBodyLength
+    \brief The number of bytes of the response body after content decoding.
+*/
+qint64 QWebEngineNetworkRequestRecord::decodedBodyLength() const
+{
+    return d->entry.decodedBodyLength;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qwebenginenetworkrequestrecord.cpp"
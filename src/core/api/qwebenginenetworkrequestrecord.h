@@ -0,0 +1,73 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINENETWORKREQUESTRECORD_H
+#define QWEBENGINENETWORKREQUESTRECORD_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebengineurlrequestinfo.h>
+
+#include <QtCore/qobject.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qurl.h>
+
+namespace QtWebEngineCore {
+struct NetworkRequestEntry;
+}
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineNetworkRequestRecordPrivate;
+
+class Q_WEBENGINECORE_EXPORT QWebEngineNetworkRequestRecord
+{
+    Q_GADGET
+    Q_PROPERTY(QUrl url READ url CONSTANT FINAL)
+    Q_PROPERTY(QUrl initiator READ initiator CONSTANT FINAL)
+    Q_PROPERTY(QWebEngineUrlRequestInfo::ResourceType resourceType READ resourceType CONSTANT FINAL)
+    Q_PROPERTY(int statusCode READ statusCode CONSTANT FINAL)
+    Q_PROPERTY(int error READ error CONSTANT FINAL)
+    Q_PROPERTY(bool fromCache READ fromCache CONSTANT FINAL)
+    Q_PROPERTY(qint64 dnsDuration READ dnsDuration CONSTANT FINAL)
+    Q_PROPERTY(qint64 connectDuration READ connectDuration CONSTANT FINAL)
+    Q_PROPERTY(qint64 sslDuration READ sslDuration CONSTANT FINAL)
+    Q_PROPERTY(qint64 timeToFirstByte READ timeToFirstByte CONSTANT FINAL)
+    Q_PROPERTY(qint64 downloadDuration READ downloadDuration CONSTANT FINAL)
+    Q_PROPERTY(qint64 totalDuration READ totalDuration CONSTANT FINAL)
+    Q_PROPERTY(qint64 encodedDataLength READ encodedDataLength CONSTANT FINAL)
+    Q_PROPERTY(qint64 encodedBodyLength READ encodedBodyLength CONSTANT FINAL)
+    Q_PROPERTY(qint64 decodedBodyLength READ decodedBodyLength CONSTANT FINAL)
+
+public:
+    QWebEngineNetworkRequestRecord();
+    QWebEngineNetworkRequestRecord(const QWebEngineNetworkRequestRecord &other);
+    QWebEngineNetworkRequestRecord &operator=(const QWebEngineNetworkRequestRecord &other);
+    ~QWebEngineNetworkRequestRecord();
+
+    QUrl url() const;
+    QUrl initiator() const;
+    QWebEngineUrlRequestInfo::ResourceType resourceType() const;
+    int statusCode() const;
+    int error() const;
+    bool fromCache() const;
+    qint64 dnsDuration() const;
+    qint64 connectDuration() const;
+    qint64 sslDuration() const;
+    qint64 timeToFirstByte() const;
+    qint64 downloadDuration() const;
+    qint64 totalDuration() const;
+    qint64 encodedDataLength() const;
+    qint64 encodedBodyLength() const;
+    qint64 decodedBodyLength() const;
+
+private:
+    explicit QWebEngineNetworkRequestRecord(const QtWebEngineCore::NetworkRequestEntry &entry);
+
+    QSharedDataPointer<QWebEngineNetworkRequestRecordPrivate> d;
+
+    friend class QWebEnginePage;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINENETWORKREQUESTRECORD_H
@@ -5,7 +5,9 @@
 #include "authenticator_request_dialog_controller.h"
 #include "qwebenginepage_p.h"
 
+#include "qwebenginecapturedframe.h"
 #include "qwebenginecertificateerror.h"
+#include "qwebenginecompositorstatistics.h"
 #include "qwebenginedesktopmediarequest.h"
 #include "qwebenginefilesystemaccessrequest.h"
 #include "qwebenginefindtextresult.h"
@@ -15,6 +17,7 @@
 #include "qwebenginehttprequest.h"
 #include "qwebengineloadinginfo.h"
 #include "qwebenginenavigationrequest.h"
+#include "qwebenginenetworkrequestrecord.h"
 #include "qwebenginenewwindowrequest.h"
 #include "qwebenginenewwindowrequest_p.h"
 #include "qwebengineprofile.h"
@@ -32,6 +35,7 @@
 #include "find_text_helper.h"
 #include "file_picker_controller.h"
 #include "javascript_dialog_controller.h"
+#include "net/network_request_log.h"
 #include "profile_adapter.h"
 #include "render_view_context_menu_qt.h"
 #include "render_widget_host_view_qt_delegate.h"
@@ -167,6 +171,8 @@ void QWebEnginePagePrivate::initializationFinished()
         adapter->setAudioMuted(defaultAudioMuted);
     if (!qFuzzyCompare(adapter->currentZoomFactor(), defaultZoomFactor))
         adapter->setZoomFactor(defaultZoomFactor);
+    if (maximumFrameRate != adapter->maximumFrameRate())
+        adapter->setMaximumFrameRate(maximumFrameRate);
     if (view)
         adapter->setVisible(view->isVisible());
 
@@ -1013,6 +1019,16 @@ QWebEnginePage::QWebEnginePage(QObject* parent)
   This signal is emitted when the underlying render process PID, \a pid, changes.
 */
 
+/*!
+  \fn void QWebEnginePage::maximumFrameRateChanged(int framesPerSecond)
+  \since 6.10
+
+  This signal is emitted when the maximum frame rate of the page changes
+  to \a framesPerSecond.
+
+  \sa maximumFrameRate
+*/
+
 /*!
     \fn void QWebEnginePage::iconUrlChanged(const QUrl &url)
 
@@ -1198,6 +1214,35 @@ void QWebEnginePage::setAudioMuted(bool muted) {
         Q_EMIT audioMutedChanged(muted);
 }
 
+/*!
+    \property QWebEnginePage::maximumFrameRate
+    \brief The maximum number of frames per second the page renders.
+    \since 6.10
+
+    Limits how often the page's compositor and its renderer start a new
+    frame, which throttles animations and reduces CPU usage for pages that
+    do not need to update at full rate, such as thumbnails.
+
+    The default value is \c 0, which means the page renders at the default
+    rate. Negative values are treated as \c 0.
+*/
+int QWebEnginePage::maximumFrameRate() const
+{
+    Q_D(const QWebEnginePage);
+    return d->maximumFrameRate;
+}
+
+void QWebEnginePage::setMaximumFrameRate(int framesPerSecond)
+{
+    Q_D(QWebEnginePage);
+    framesPerSecond = qMax(framesPerSecond, 0);
+    if (d->maximumFrameRate == framesPerSecond)
+        return;
+    d->maximumFrameRate = framesPerSecond;
+    d->adapter->setMaximumFrameRate(framesPerSecond);
+    Q_EMIT maximumFrameRateChanged(framesPerSecond);
+}
+
 /*!
     \property QWebEnginePage::recentlyAudible
     \brief The current page's \e {audible state}, that is, whether audio was recently played
@@ -2583,6 +2628,135 @@ std::optional<QWebEngineFrame> QWebEnginePage::findFrameByName(QAnyStringView na
     return {};
 }
 
+/*!
+    \since 6.10
+
+    Returns the compositor frame counters of the page since its current
+    view was created or resetCompositorStatistics() was called.
+
+    The counters are collected all the time and are cheap to query, but
+    they are reset when the page is moved to a new render process.
+
+    \sa QWebEngineCompositorStatistics
+*/
+QWebEngineCompositorStatistics QWebEnginePage::compositorStatistics() const
+{
+    Q_D(const QWebEnginePage);
+    return QWebEngineCompositorStatistics(d->adapter->frameStatistics());
+}
+
+/*!
+    \since 6.10
+
+    Resets the compositor frame counters of the page.
+
+    \sa compositorStatistics()
+*/
+void QWebEnginePage::resetCompositorStatistics()
+{
+    Q_D(QWebEnginePage);
+    d->adapter->resetFrameStatistics();
+}
+
+/*!
+    \since 6.10
+
+    Starts delivering the frames produced by the page's compositor through
+    the frameCaptured() signal, at most \a maximumFrameRate frames per second.
+    A \a maximumFrameRate of \c 0 delivers frames as fast as they are produced.
+
+    Only one frame is queued for delivery at a time. Frames produced while
+    a frame is waiting to be delivered, or before the maximum frame rate
+    allows the next delivery, replace the waiting frame and add their damage
+    to it. A slow receiver thereby skips frames instead of accumulating them.
+
+    Frames are only captured when the page is rendered with the software
+    compositor, which is the case when GPU acceleration is disabled or the
+    Qt Quick software adaptation is used.
+
+    \sa stopFrameCapture(), QWebEngineCapturedFrame
+*/
+void QWebEnginePage::startFrameCapture(qreal maximumFrameRate)
+{
+    Q_D(QWebEnginePage);
+    QPointer<QWebEnginePage> page(this);
+    d->adapter->startFrameCapture(maximumFrameRate,
+                                  [page](const QImage &image, const QRegion &damage, qint64 timestamp) {
+                                      if (page)
+                                          Q_EMIT page->frameCaptured(QWebEngineCapturedFrame(image, damage, timestamp));
+                                  });
+}
+
+/*!
+    \since 6.10
+
+    Stops delivering frames started by startFrameCapture().
+*/
+void QWebEnginePage::stopFrameCapture()
+{
+    Q_D(QWebEnginePage);
+    d->adapter->stopFrameCapture();
+}
+
+/*!
+    \fn void QWebEnginePage::frameCaptured(const QWebEngineCapturedFrame &frame)
+    \since 6.10
+
+    This signal is emitted with each captured \a frame after startFrameCapture()
+    was called.
+*/
+
+/*!
+    \since 6.10
+
+    Starts recording the network requests of this page as they finish, and
+    delivering them through the networkRequestsFinished() signal.
+
+    Records are collected and delivered in batches, at the latest half a
+    second after the first request of a batch finished, so a page making many
+    requests does not cause a signal emission for each of them. Only requests
+    that can be attributed to the page's frames are recorded. Requests blocked
+    by URL request rules or a request interceptor are recorded as well, with
+    the error they failed with.
+
+    \sa stopNetworkRequestLog(), QWebEngineNetworkRequestRecord
+*/
+void QWebEnginePage::startNetworkRequestLog()
+{
+    Q_D(QWebEnginePage);
+    QPointer<QWebEnginePage> page(this);
+    d->adapter->startNetworkRequestLog(
+            [page](const QList<QtWebEngineCore::NetworkRequestEntry> &entries) {
+                if (!page)
+                    return;
+                QList<QWebEngineNetworkRequestRecord> records;
+                records.reserve(entries.size());
+                for (const QtWebEngineCore::NetworkRequestEntry &entry : entries)
+                    records.append(QWebEngineNetworkRequestRecord(entry));
+                Q_EMIT page->networkRequestsFinished(records);
+            });
+}
+
+/*!
+    \since 6.10
+
+    Stops recording network requests started by startNetworkRequestLog().
+    Requests that were already recorded are delivered right away.
+*/
+void QWebEnginePage::stopNetworkRequestLog()
+{
+    Q_D(QWebEnginePage);
+    d->adapter->stopNetworkRequestLog();
+}
+
+/*!
+    \fn void QWebEnginePage::networkRequestsFinished(const QList<QWebEngineNetworkRequestRecord> &records)
+    \since 6.10
+
+    This signal is emitted with a batch of \a records of finished network
+    requests after startNetworkRequestLog() was called.
+*/
+
 QDataStream &operator<<(QDataStream &stream, const QWebEngineHistory &history)
 {
     auto adapter = history.d_func()->adapter();
@@ -29,7 +29,9 @@ class QContextMenuBuilder;
 class QRect;
 class QVariant;
 class QWebChannel;
+class QWebEngineCapturedFrame;
 class QWebEngineCertificateError;
+class QWebEngineCompositorStatistics;
 class QWebEngineDesktopMediaRequest;
 class QWebEngineFileSystemAccessRequest;
 class QWebEngineFindTextResult;
@@ -38,6 +40,7 @@ class QWebEngineHistory;
 class QWebEngineHttpRequest;
 class QWebEngineLoadingInfo;
 class QWebEngineNavigationRequest;
+class QWebEngineNetworkRequestRecord;
 class QWebEngineNewWindowRequest;
 class QWebEnginePagePrivate;
 class QWebEngineProfile;
@@ -68,6 +71,7 @@ class Q_WEBENGINECORE_EXPORT QWebEnginePage : public QObject
     Q_PROPERTY(LifecycleState recommendedState READ recommendedState NOTIFY recommendedStateChanged)
     Q_PROPERTY(qint64 renderProcessPid READ renderProcessPid NOTIFY renderProcessPidChanged)
     Q_PROPERTY(bool loading READ isLoading NOTIFY loadingChanged FINAL)
+    Q_PROPERTY(int maximumFrameRate READ maximumFrameRate WRITE setMaximumFrameRate NOTIFY maximumFrameRateChanged FINAL)
 
 public:
     enum WebAction {
@@ -303,6 +307,9 @@ public:
     bool recentlyAudible() const;
     qint64 renderProcessPid() const;
 
+    int maximumFrameRate() const;
+    void setMaximumFrameRate(int framesPerSecond);
+
     void printToPdf(const QString &filePath,
                     const QPageLayout &layout = QPageLayout(QPageSize(QPageSize::A4), QPageLayout::Portrait, QMarginsF()),
                     const QPageRanges &ranges = {});
@@ -329,6 +336,15 @@ public:
     QWebEngineFrame mainFrame();
     std::optional<QWebEngineFrame> findFrameByName(QAnyStringView name);
 
+    QWebEngineCompositorStatistics compositorStatistics() const;
+    void resetCompositorStatistics();
+
+    void startFrameCapture(qreal maximumFrameRate = 0);
+    void stopFrameCapture();
+
+    void startNetworkRequestLog();
+    void stopNetworkRequestLog();
+
     void acceptAsNewWindow(QWebEngineNewWindowRequest &request);
 
 Q_SIGNALS:
@@ -382,6 +398,7 @@ Q_SIGNALS:
     void audioMutedChanged(bool muted);
     void recentlyAudibleChanged(bool recentlyAudible);
     void renderProcessPidChanged(qint64 pid);
+    void maximumFrameRateChanged(int framesPerSecond);
 
     void pdfPrintingFinished(const QString &filePath, bool success);
     void printRequested();
@@ -399,6 +416,9 @@ Q_SIGNALS:
 
     void webAuthUxRequested(QWebEngineWebAuthUxRequest *request);
 
+    void frameCaptured(const QWebEngineCapturedFrame &frame);
+    void networkRequestsFinished(const QList<QWebEngineNetworkRequestRecord> &records);
+
 protected:
     virtual QWebEnginePage *createWindow(WebWindowType type);
     virtual QStringList chooseFiles(FileSelectionMode mode, const QStringList &oldFiles,
@@ -217,6 +217,7 @@ public:
     QPointer<QWebEnginePage> devToolsPage;
     bool defaultAudioMuted;
     qreal defaultZoomFactor;
+    int maximumFrameRate = 0;
     QTimer wasShownTimer;
     QtWebEngineCore::RenderWidgetHostViewQtDelegateItem *delegateItem = nullptr;
 #if QT_CONFIG(webengine_printing_and_pdf)
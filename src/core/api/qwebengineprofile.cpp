@@ -11,6 +11,8 @@
 #include "qwebenginesettings.h"
 #include "qwebenginescriptcollection.h"
 #include "qwebenginescriptcollection_p.h"
+#include "qwebengineurlrequestrule.h"
+#include "qwebengineurlresponseinterceptor.h"
 #include "qwebenginepermission_p.h"
 #include "qtwebenginecoreglobal.h"
 #include "profile_adapter.h"
@@ -67,6 +69,8 @@ using QtWebEngineCore::ProfileAdapter;
     Implementing the QWebEngineUrlRequestInterceptor interface and registering the interceptor on a
     profile by setUrlRequestInterceptor() enables intercepting, blocking, and modifying URL
     requests (QWebEngineUrlRequestInfo) before they reach the networking stack of Chromium.
+    Requests that only need to be blocked, redirected, or have headers changed by URL pattern
+    can be handled without an interceptor by setUrlRequestRules().
 
     A QWebEngineUrlSchemeHandler can be registered for a profile by installUrlSchemeHandler()
     to add support for custom URL schemes. Requests for the scheme are then issued to
@@ -178,6 +182,7 @@ QWebEngineProfilePrivate::~QWebEngineProfilePrivate()
         // In the case the user sets this profile as the parent of the interceptor
         // it can be deleted before the browser-context still referencing it is.
         m_profileAdapter->setRequestInterceptor(nullptr);
+        m_profileAdapter->setResponseInterceptor(nullptr);
         m_profileAdapter->removeClient(this);
     }
 
@@ -671,6 +676,57 @@ void QWebEngineProfile::setUrlRequestInterceptor(QWebEngineUrlRequestInterceptor
     d->profileAdapter()->setRequestInterceptor(interceptor);
 }
 
+/*!
+    Registers a response interceptor singleton \a interceptor to rewrite URL responses.
+
+    The interceptor sees the responses of requests made by this profile's pages and can change
+    their headers and transform their bodies as they stream in. The profile does not take
+    ownership of the pointer. To unset the response interceptor, set a \c nullptr.
+
+    \since 6.10
+    \sa QWebEngineUrlResponseInfo QWebEngineUrlResponseInterceptor
+*/
+
+void QWebEngineProfile::setUrlResponseInterceptor(QWebEngineUrlResponseInterceptor *interceptor)
+{
+    Q_D(QWebEngineProfile);
+    d->profileAdapter()->setResponseInterceptor(interceptor);
+}
+
+/*!
+    Returns the URL request rules of this profile.
+
+    \since 6.10
+    \sa setUrlRequestRules()
+*/
+
+QList<QWebEngineUrlRequestRule> QWebEngineProfile::urlRequestRules() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->profileAdapter()->urlRequestRules();
+}
+
+/*!
+    Replaces the URL request rules of this profile with \a rules.
+
+    The rules are compiled once and evaluated for every request of the profile before the
+    request interceptor is consulted, without calling into application code. Requests blocked
+    or redirected by a rule never reach the interceptor. See QWebEngineUrlRequestRule for the
+    pattern syntax and how matching rules combine.
+
+    Requests that have already started keep the rules they started with. Pass an empty list
+    to remove all rules.
+
+    \since 6.10
+    \sa urlRequestRules() setUrlRequestInterceptor()
+*/
+
+void QWebEngineProfile::setUrlRequestRules(const QList<QWebEngineUrlRequestRule> &rules)
+{
+    Q_D(QWebEngineProfile);
+    d->profileAdapter()->setUrlRequestRules(rules);
+}
+
 /*!
     Clears all links from the visited links database.
 
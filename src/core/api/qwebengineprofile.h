@@ -26,6 +26,8 @@ class QWebEngineProfilePrivate;
 class QWebEngineSettings;
 class QWebEngineScriptCollection;
 class QWebEngineUrlRequestInterceptor;
+class QWebEngineUrlRequestRule;
+class QWebEngineUrlResponseInterceptor;
 class QWebEngineUrlSchemeHandler;
 
 class Q_WEBENGINECORE_EXPORT QWebEngineProfile : public QObject
@@ -86,6 +88,10 @@ public:
 
     QWebEngineCookieStore *cookieStore();
     void setUrlRequestInterceptor(QWebEngineUrlRequestInterceptor *interceptor);
+    void setUrlResponseInterceptor(QWebEngineUrlResponseInterceptor *interceptor);
+
+    QList<QWebEngineUrlRequestRule> urlRequestRules() const;
+    void setUrlRequestRules(const QList<QWebEngineUrlRequestRule> &rules);
 
     void clearAllVisitedLinks();
     void clearVisitedLinks(const QList<QUrl> &urls);
@@ -0,0 +1,179 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebengineurlrequestdecision.h"
+#include "qwebengineurlrequestdecision_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QWebEngineUrlRequestDecisionPrivate)
+
+/*!
+    \class QWebEngineUrlRequestDecision
+    \brief The QWebEngineUrlRequestDecision class lets a request interceptor
+    decide about a request after returning from
+    QWebEngineUrlRequestInterceptor::interceptRequest().
+    \since 6.10
+
+    \inmodule QtWebEngineCore
+
+    A decision is obtained by calling QWebEngineUrlRequestInfo::defer() from
+    QWebEngineUrlRequestInterceptor::interceptRequest(). The request is held
+    back until complete() is called, which can happen later and from any
+    thread. This lets an interceptor consult a slow policy service without
+    blocking the UI thread:
+
+    \code
+    void Interceptor::interceptRequest(QWebEngineUrlRequestInfo &info)
+    {
+        QWebEngineUrlRequestDecision decision = info.defer();
+        m_policy->check(info.requestUrl(), [decision](bool allowed) mutable {
+            decision.block(!allowed);
+            decision.complete();
+        });
+    }
+    \endcode
+
+    Calls to block(), redirect() and setHttpHeader() are applied to the request
+    when the decision is completed, in addition to the changes made to the
+    QWebEngineUrlRequestInfo during interceptRequest(). If every copy of a
+    decision is destroyed without calling complete(), the request continues
+    with the changes made so far.
+
+    \sa QWebEngineUrlRequestInfo::defer()
+*/
+
+QWebEngineUrlRequestDecisionPrivate::~QWebEngineUrlRequestDecisionPrivate()
+{
+    complete();
+}
+
+void QWebEngineUrlRequestDecisionPrivate::setCallback(Callback newCallback)
+{
+    QMutexLocker locker(&mutex);
+    if (!completed) {
+        callback = std::move(newCallback);
+        return;
+    }
+    locker.unlock();
+    newCallback(std::move(decision));
+}
+
+void QWebEngineUrlRequestDecisionPrivate::complete()
+{
+    QMutexLocker locker(&mutex);
+    if (completed)
+        return;
+    completed = true;
+    if (!callback)
+        return; // Delivered by setCallback().
+    Callback pending = std::move(callback);
+    callback = nullptr;
+    locker.unlock();
+    pending(std::move(decision));
+}
+
+/*!
+    Constructs an invalid decision.
+*/
+QWebEngineUrlRequestDecision::QWebEngineUrlRequestDecision() = default;
+
+/*!
+    \internal
+*/
+QWebEngineUrlRequestDecision::QWebEngineUrlRequestDecision(QWebEngineUrlRequestDecisionPrivate *d)
+    : d(d)
+{
+}
+
+/*!
+    Constructs a copy of \a other, which refers to the same request.
+*/
+QWebEngineUrlRequestDecision::QWebEngineUrlRequestDecision(
+        const QWebEngineUrlRequestDecision &other) = default;
+
+/*!
+    Assigns \a other to this decision.
+*/
+QWebEngineUrlRequestDecision &
+QWebEngineUrlRequestDecision::operator=(const QWebEngineUrlRequestDecision &other) = default;
+
+/*!
+    Move-constructs a decision from \a other.
+*/
+QWebEngineUrlRequestDecision::QWebEngineUrlRequestDecision(
+        QWebEngineUrlRequestDecision &&other) noexcept = default;
+
+/*!
+    Move-assigns \a other to this decision.
+*/
+QWebEngineUrlRequestDecision &
+QWebEngineUrlRequestDecision::operator=(QWebEngineUrlRequestDecision &&other) noexcept = default;
+
+/*!
+    Destroys the decision. The request continues once all copies are destroyed,
+    even if complete() was not called.
+*/
+QWebEngineUrlRequestDecision::~QWebEngineUrlRequestDecision() = default;
+
+/*!
+    Returns \c true if the decision refers to a request.
+*/
+bool QWebEngineUrlRequestDecision::isValid() const
+{
+    return d;
+}
+
+/*!
+    Blocks the request if \a shouldBlock is \c true.
+
+    \sa QWebEngineUrlRequestInfo::block()
+*/
+void QWebEngineUrlRequestDecision::block(bool shouldBlock)
+{
+    if (!d)
+        return;
+    QMutexLocker locker(&d->mutex);
+    if (!d->completed)
+        d->decision.block = shouldBlock;
+}
+
+/*!
+    Redirects the request to \a url.
+
+    \sa QWebEngineUrlRequestInfo::redirect()
+*/
+void QWebEngineUrlRequestDecision::redirect(const QUrl &url)
+{
+    if (!d)
+        return;
+    QMutexLocker locker(&d->mutex);
+    if (!d->completed)
+        d->decision.redirectUrl = url;
+}
+
+/*!
+    Sets the request header \a name to \a value.
+
+    \sa QWebEngineUrlRequestInfo::setHttpHeader()
+*/
+void QWebEngineUrlRequestDecision::setHttpHeader(const QByteArray &name, const QByteArray &value)
+{
+    if (!d)
+        return;
+    QMutexLocker locker(&d->mutex);
+    if (!d->completed)
+        d->decision.headers.append({ name, value });
+}
+
+/*!
+    Lets the request continue with the decision. Changes made after this call
+    are ignored.
+*/
+void QWebEngineUrlRequestDecision::complete()
+{
+    if (d)
+        d->complete();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,45 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLREQUESTDECISION_H
+#define QWEBENGINEURLREQUESTDECISION_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qurl.h>
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineUrlRequestDecisionPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QWebEngineUrlRequestDecisionPrivate,
+                                                 Q_WEBENGINECORE_EXPORT)
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlRequestDecision
+{
+public:
+    QWebEngineUrlRequestDecision();
+    QWebEngineUrlRequestDecision(const QWebEngineUrlRequestDecision &other);
+    QWebEngineUrlRequestDecision &operator=(const QWebEngineUrlRequestDecision &other);
+    QWebEngineUrlRequestDecision(QWebEngineUrlRequestDecision &&other) noexcept;
+    QWebEngineUrlRequestDecision &operator=(QWebEngineUrlRequestDecision &&other) noexcept;
+    ~QWebEngineUrlRequestDecision();
+
+    bool isValid() const;
+
+    void block(bool shouldBlock);
+    void redirect(const QUrl &url);
+    void setHttpHeader(const QByteArray &name, const QByteArray &value);
+    void complete();
+
+private:
+    friend class QWebEngineUrlRequestInfo;
+    explicit QWebEngineUrlRequestDecision(QWebEngineUrlRequestDecisionPrivate *d);
+
+    QExplicitlySharedDataPointer<QWebEngineUrlRequestDecisionPrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLREQUESTDECISION_H
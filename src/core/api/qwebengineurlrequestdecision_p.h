@@ -0,0 +1,56 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLREQUESTDECISION_P_H
+#define QWEBENGINEURLREQUESTDECISION_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qtwebenginecoreglobal_p.h"
+#include "qwebengineurlrequestdecision.h"
+
+#include <QtCore/qlist.h>
+#include <QtCore/qmutex.h>
+
+#include <functional>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+// Shared by the copies of a QWebEngineUrlRequestDecision, which may live on any
+// thread. The decision is handed to the callback once, when it is completed or
+// when the last copy is dropped.
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlRequestDecisionPrivate : public QSharedData
+{
+public:
+    struct Decision
+    {
+        std::optional<bool> block;
+        std::optional<QUrl> redirectUrl;
+        QList<std::pair<QByteArray, QByteArray>> headers;
+    };
+    using Callback = std::function<void(Decision)>;
+
+    ~QWebEngineUrlRequestDecisionPrivate();
+
+    void setCallback(Callback callback);
+    void complete();
+
+    QMutex mutex;
+    Decision decision;
+    bool completed = false;
+    Callback callback;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLREQUESTDECISION_P_H
@@ -52,6 +52,10 @@ ASSERT_ENUMS_MATCH(QtWebEngineCore::WebContentsAdapterClient::RedirectNavigation
     You can install the interceptor on a profile via QWebEngineProfile::setUrlRequestInterceptor()
     or QQuickWebEngineProfile::setUrlRequestInterceptor().
 
+    An interceptor that only cares about some requests can say so with
+    setResourceTypeFilter(), setSchemeFilter(), and setHostFilter(). Other
+    requests then bypass it without any per-request work.
+
     When using the \l{Qt WebEngine Widgets Module}, \l{QWebEnginePage::acceptNavigationRequest()}
     offers further options to accept or block requests.
 
@@ -73,6 +77,10 @@ ASSERT_ENUMS_MATCH(QtWebEngineCore::WebContentsAdapterClient::RedirectNavigation
     \a info contains the information about the URL request and will track internally
     whether its members have been altered.
 
+    To decide later without stalling the UI thread, call
+    QWebEngineUrlRequestInfo::defer() and complete the returned
+    QWebEngineUrlRequestDecision when the decision is known.
+
     \warning All method calls to the profile on the main thread will block until
     execution of this function is finished.
 */
@@ -340,4 +348,32 @@ QHash<QByteArray, QByteArray> QWebEngineUrlRequestInfo::httpHeaders() const
     return d_ptr->extraHeaders;
 }
 
+/*!
+    \since 6.10
+
+    Holds the request back until the returned decision is completed, so that
+    the interceptor can decide about it after returning from
+    QWebEngineUrlRequestInterceptor::interceptRequest(), from any thread.
+
+    Changes made to this object before returning from interceptRequest() still
+    apply. The object must not be used after interceptRequest() returns; use
+    the returned QWebEngineUrlRequestDecision instead.
+
+    Requests for WebSocket connections cannot be deferred, in which case an
+    invalid decision is returned and the request continues as soon as
+    interceptRequest() returns.
+
+    \sa QWebEngineUrlRequestDecision::complete()
+*/
+QWebEngineUrlRequestDecision QWebEngineUrlRequestInfo::defer()
+{
+    if (!d_ptr->deferrable) {
+        qWarning("QWebEngineUrlRequestInfo::defer(): This request cannot be deferred.");
+        return QWebEngineUrlRequestDecision();
+    }
+    if (!d_ptr->deferral)
+        d_ptr->deferral = new QWebEngineUrlRequestDecisionPrivate;
+    return QWebEngineUrlRequestDecision(d_ptr->deferral.data());
+}
+
 QT_END_NAMESPACE
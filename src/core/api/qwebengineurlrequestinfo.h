@@ -5,6 +5,7 @@
 #define QWEBENGINEURLREQUESTINFO_H
 
 #include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebengineurlrequestdecision.h>
 
 #include <QtCore/qurl.h>
 #include <QtCore/qiodevice.h>
@@ -79,6 +80,8 @@ public:
     void setHttpHeader(const QByteArray &name, const QByteArray &value);
     QHash<QByteArray, QByteArray> httpHeaders() const;
 
+    QWebEngineUrlRequestDecision defer();
+
 private:
     friend class QtWebEngineCore::ContentBrowserClientQt;
     friend class QtWebEngineCore::InterceptedRequest;
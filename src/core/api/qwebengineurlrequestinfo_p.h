@@ -18,6 +18,7 @@
 #include "qtwebenginecoreglobal_p.h"
 
 #include "qwebengineurlrequestinfo.h"
+#include "qwebengineurlrequestdecision_p.h"
 
 #include <QByteArray>
 #include <QHash>
@@ -57,6 +58,9 @@ public:
     QHash<QByteArray, QByteArray> extraHeaders;
     QtWebEngineCore::ResourceRequestBody *const resourceRequestBody;
     bool isDownload;
+    // Set by the caller if the interceptor may decide asynchronously.
+    bool deferrable = false;
+    QExplicitlySharedDataPointer<QWebEngineUrlRequestDecisionPrivate> deferral;
 
     QWebEngineUrlRequestInfo *q_ptr;
 };
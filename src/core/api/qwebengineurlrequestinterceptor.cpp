@@ -2,10 +2,198 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qwebengineurlrequestinterceptor.h"
+#include "qwebengineurlrequestinterceptor_p.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QUrl>
+
+#include <algorithm>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+struct InterceptorFilters
+{
+    QMutex mutex;
+    QHash<const QWebEngineUrlRequestInterceptor *,
+          std::shared_ptr<const QWebEngineUrlRequestInterceptorPrivate>> filters;
+};
+
+InterceptorFilters &interceptorFilters()
+{
+    static InterceptorFilters filters;
+    return filters;
+}
+} // namespace
+
 // Has to stay empty till Qt7
 QWebEngineUrlRequestInterceptor::~QWebEngineUrlRequestInterceptor() = default;
 
+std::shared_ptr<const QWebEngineUrlRequestInterceptorPrivate>
+QWebEngineUrlRequestInterceptorPrivate::get(const QWebEngineUrlRequestInterceptor *interceptor)
+{
+    InterceptorFilters &registry = interceptorFilters();
+    QMutexLocker locker(&registry.mutex);
+    return registry.filters.value(interceptor);
+}
+
+void QWebEngineUrlRequestInterceptorPrivate::update(
+        QWebEngineUrlRequestInterceptor *interceptor,
+        const std::function<void(QWebEngineUrlRequestInterceptorPrivate &)> &change)
+{
+    InterceptorFilters &registry = interceptorFilters();
+    QMutexLocker locker(&registry.mutex);
+    auto &filter = registry.filters[interceptor];
+    if (!filter) {
+        // The entry is dropped from QObject's destructor, so that an interceptor
+        // allocated at the same address later does not inherit the filters.
+        QObject::connect(interceptor, &QObject::destroyed, interceptor, [interceptor]() {
+            InterceptorFilters &filters = interceptorFilters();
+            QMutexLocker destroyedLocker(&filters.mutex);
+            filters.filters.remove(interceptor);
+        }, Qt::DirectConnection);
+    }
+    auto updated = filter ? std::make_shared<QWebEngineUrlRequestInterceptorPrivate>(*filter)
+                          : std::make_shared<QWebEngineUrlRequestInterceptorPrivate>();
+    change(*updated);
+    filter = std::move(updated);
+}
+
+bool QWebEngineUrlRequestInterceptorPrivate::wantsRequest(
+        const QWebEngineUrlRequestInterceptor *interceptor, int resourceType,
+        std::string_view scheme, std::string_view host)
+{
+    if (!interceptor)
+        return false;
+    const auto filter = get(interceptor);
+    return !filter || filter->matches(resourceType, scheme, host);
+}
+
+bool QWebEngineUrlRequestInterceptorPrivate::matches(int resourceType, std::string_view scheme,
+                                                     std::string_view host) const
+{
+    if (resourceTypes.any()
+        && (resourceType < 0 || resourceType >= 256 || !resourceTypes.test(resourceType)))
+        return false;
+    if (!schemes.empty() && std::find(schemes.begin(), schemes.end(), scheme) == schemes.end())
+        return false;
+    if (hosts.empty())
+        return true;
+    for (const std::string &filterHost : hosts) {
+        // A host also covers its subdomains.
+        if (host.size() >= filterHost.size()
+            && host.substr(host.size() - filterHost.size()) == filterHost
+            && (host.size() == filterHost.size() || host[host.size() - filterHost.size() - 1] == '.'))
+            return true;
+    }
+    return false;
+}
+
+/*!
+    \since 6.10
+
+    Returns the resource types this interceptor is called for.
+
+    \sa setResourceTypeFilter()
+*/
+QList<QWebEngineUrlRequestInfo::ResourceType> QWebEngineUrlRequestInterceptor::resourceTypeFilter() const
+{
+    const auto d = QWebEngineUrlRequestInterceptorPrivate::get(this);
+    return d ? d->resourceTypeList : QList<QWebEngineUrlRequestInfo::ResourceType>();
+}
+
+/*!
+    \since 6.10
+
+    Limits interceptRequest() to requests for resources of one of \a types.
+
+    Requests that do not pass the filters of an interceptor skip it without
+    a QWebEngineUrlRequestInfo being built for them, which saves that work
+    for every request the interceptor would ignore anyway. All filters that
+    are set have to match. An empty list, the default, matches any request.
+
+    The filters can be changed while the interceptor is installed. Requests
+    that are already being checked may still use the previous filters.
+
+    \sa setSchemeFilter(), setHostFilter()
+*/
+void QWebEngineUrlRequestInterceptor::setResourceTypeFilter(
+        const QList<QWebEngineUrlRequestInfo::ResourceType> &types)
+{
+    QWebEngineUrlRequestInterceptorPrivate::update(this, [&types](auto &d) {
+        d.resourceTypeList = types;
+        d.resourceTypes.reset();
+        for (QWebEngineUrlRequestInfo::ResourceType type : types) {
+            if (type >= 0 && type < 256)
+                d.resourceTypes.set(type);
+        }
+    });
+}
+
+/*!
+    \since 6.10
+
+    Returns the URL schemes this interceptor is called for.
+
+    \sa setSchemeFilter()
+*/
+QStringList QWebEngineUrlRequestInterceptor::schemeFilter() const
+{
+    const auto d = QWebEngineUrlRequestInterceptorPrivate::get(this);
+    return d ? d->schemeList : QStringList();
+}
+
+/*!
+    \since 6.10
+
+    Limits interceptRequest() to requests for URLs with one of \a schemes,
+    compared case-insensitively. An empty list, the default, matches any
+    scheme.
+
+    \sa setResourceTypeFilter(), setHostFilter()
+*/
+void QWebEngineUrlRequestInterceptor::setSchemeFilter(const QStringList &schemes)
+{
+    QWebEngineUrlRequestInterceptorPrivate::update(this, [&schemes](auto &d) {
+        d.schemeList = schemes;
+        d.schemes.clear();
+        for (const QString &scheme : schemes)
+            d.schemes.push_back(scheme.toLower().toStdString());
+    });
+}
+
+/*!
+    \since 6.10
+
+    Returns the hosts this interceptor is called for.
+
+    \sa setHostFilter()
+*/
+QStringList QWebEngineUrlRequestInterceptor::hostFilter() const
+{
+    const auto d = QWebEngineUrlRequestInterceptorPrivate::get(this);
+    return d ? d->hostList : QStringList();
+}
+
+/*!
+    \since 6.10
+
+    Limits interceptRequest() to requests for URLs on one of \a hosts or
+    their subdomains, so that \c{example.com} also matches
+    \c{www.example.com}. An empty list, the default, matches any host.
+
+    \sa setResourceTypeFilter(), setSchemeFilter()
+*/
+void QWebEngineUrlRequestInterceptor::setHostFilter(const QStringList &hosts)
+{
+    QWebEngineUrlRequestInterceptorPrivate::update(this, [&hosts](auto &d) {
+        d.hostList = hosts;
+        d.hosts.clear();
+        for (const QString &host : hosts)
+            d.hosts.push_back(QUrl::toAce(host.toLower()).toStdString());
+    });
+}
+
 QT_END_NAMESPACE
@@ -7,7 +7,9 @@
 #include <QtWebEngineCore/qtwebenginecoreglobal.h>
 #include <QtWebEngineCore/qwebengineurlrequestinfo.h>
 
+#include <QtCore/qlist.h>
 #include <QtCore/qobject.h>
+#include <QtCore/qstringlist.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -18,6 +20,13 @@ public:
     explicit QWebEngineUrlRequestInterceptor(QObject *p = nullptr) : QObject(p) {}
     ~QWebEngineUrlRequestInterceptor() override;
     virtual void interceptRequest(QWebEngineUrlRequestInfo &info) = 0;
+
+    QList<QWebEngineUrlRequestInfo::ResourceType> resourceTypeFilter() const;
+    void setResourceTypeFilter(const QList<QWebEngineUrlRequestInfo::ResourceType> &types);
+    QStringList schemeFilter() const;
+    void setSchemeFilter(const QStringList &schemes);
+    QStringList hostFilter() const;
+    void setHostFilter(const QStringList &hosts);
 };
 
 QT_END_NAMESPACE
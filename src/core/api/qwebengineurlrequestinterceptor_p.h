@@ -0,0 +1,62 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLREQUESTINTERCEPTOR_P_H
+#define QWEBENGINEURLREQUESTINTERCEPTOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qtwebenginecoreglobal_p.h"
+
+#include "qwebengineurlrequestinterceptor.h"
+
+#include <bitset>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+// The requests an interceptor declared interest in. Kept outside of
+// QWebEngineUrlRequestInterceptor, which has no room for data of its own.
+// Instances are never modified once registered: setting a filter replaces
+// the registered instance with an updated copy, so that the IO thread can
+// keep using the one it looked up while the filters change.
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlRequestInterceptorPrivate
+{
+public:
+    // Whether |interceptor| wants to see a request, checked before building
+    // the QWebEngineUrlRequestInfo for it. |scheme| and |host| are lowercase.
+    static bool wantsRequest(const QWebEngineUrlRequestInterceptor *interceptor,
+                             int resourceType, std::string_view scheme, std::string_view host);
+
+    static std::shared_ptr<const QWebEngineUrlRequestInterceptorPrivate>
+    get(const QWebEngineUrlRequestInterceptor *interceptor);
+    static void update(QWebEngineUrlRequestInterceptor *interceptor,
+                       const std::function<void(QWebEngineUrlRequestInterceptorPrivate &)> &change);
+
+    bool matches(int resourceType, std::string_view scheme, std::string_view host) const;
+
+    QList<QWebEngineUrlRequestInfo::ResourceType> resourceTypeList;
+    QStringList schemeList;
+    QStringList hostList;
+
+    std::bitset<256> resourceTypes; // none set means any
+    std::vector<std::string> schemes;
+    std::vector<std::string> hosts;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLREQUESTINTERCEPTOR_P_H
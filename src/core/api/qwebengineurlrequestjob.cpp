@@ -45,6 +45,24 @@ QT_BEGIN_NAMESPACE
             The request failed.
 */
 
+/*!
+    \enum QWebEngineUrlRequestJob::Priority
+    \since 6.10
+
+    This enum type describes how urgently the web engine needs the response:
+
+    \value Idle
+            The response is not needed for the current page, for example a prefetch.
+    \value Lowest
+            The response is needed eventually, for example an image outside of the view.
+    \value Low
+            The response is needed soon, for example an image or an asynchronous script.
+    \value Medium
+            The response is needed to render the page, for example a script.
+    \value Highest
+            The response blocks rendering, for example the main document or a stylesheet.
+*/
+
 /*!
     \internal
  */
@@ -117,19 +135,57 @@ QMap<QByteArray, QByteArray> QWebEngineUrlRequestJob::requestHeaders() const
     a POST request. If the request body is empty, the QIODevice reflects this
     and does not return any data when performing read operations on it.
 
+    By default, reads wait until the requested data has been uploaded, for
+    example from a Blob or a ReadableStream. If streaming is enabled with
+    QWebEngineUrlSchemeHandler::setRequestBodyStreaming(), data that has not
+    been uploaded yet is not waited for. Reads then return what is available,
+    and QIODevice::readyRead() is emitted when more data arrives, so large
+    uploads can be processed incrementally. QIODevice::atEnd() returns \c true
+    once the whole body has been read.
+
     \since 6.7
-    \sa QIODevice
+    \sa QIODevice, QWebEngineUrlSchemeHandler::setRequestBodyStreaming()
 */
 QIODevice *QWebEngineUrlRequestJob::requestBody() const
 {
     return d_ptr->requestBody();
 }
 
+/*!
+    \since 6.10
+    Returns the priority of the request.
+
+    The priority can change while the request is pending, for example when an
+    image is scrolled into view. With prioritized scheduling, the priority only
+    decides when requestStarted() is called if it is known when the request is
+    made. Later changes are reported here but do not move a pending request
+    ahead of others, so the priority is advisory once the request has been made.
+
+    \sa QWebEngineUrlSchemeHandler::setPrioritizedScheduling()
+*/
+QWebEngineUrlRequestJob::Priority QWebEngineUrlRequestJob::priority() const
+{
+    switch (d_ptr->priority()) {
+    case net::THROTTLED:
+    case net::IDLE:
+        return Priority::Idle;
+    case net::LOWEST:
+        return Priority::Lowest;
+    case net::LOW:
+        return Priority::Low;
+    case net::MEDIUM:
+        return Priority::Medium;
+    case net::HIGHEST:
+        return Priority::Highest;
+    }
+    Q_UNREACHABLE_RETURN(Priority::Medium);
+}
+
 /*!
     \since 6.6
     Set \a additionalResponseHeaders. These additional headers of the response
     are only used when QWebEngineUrlRequestJob::reply(const QByteArray&, QIODevice*)
-    is called.
+    or QWebEngineUrlRequestJob::reply(const QByteArray&, const QByteArray&) is called.
 */
 void QWebEngineUrlRequestJob::setAdditionalResponseHeaders(
         const QMultiMap<QByteArray, QByteArray> &additionalResponseHeaders) const
@@ -163,6 +219,22 @@ void QWebEngineUrlRequestJob::reply(const QByteArray &contentType, QIODevice *de
     d_ptr->reply(contentType, device);
 }
 
+/*!
+    \since 6.10
+    \overload
+
+    Replies to the request with the in-memory \a data and the content type
+    \a contentType.
+
+    The web engine shares \a data with the caller through implicit sharing
+    and writes it to the renderer without an intermediate QIODevice. Range
+    requests are answered from the same data.
+ */
+void QWebEngineUrlRequestJob::reply(const QByteArray &contentType, const QByteArray &data)
+{
+    d_ptr->reply(contentType, data);
+}
+
 /*!
     Fails the request with the error \a r.
 
@@ -38,13 +38,18 @@ public:
     };
     Q_ENUM(Error)
 
+    enum class Priority { Idle, Lowest, Low, Medium, Highest };
+    Q_ENUM(Priority)
+
     QUrl requestUrl() const;
     QByteArray requestMethod() const;
     QUrl initiator() const;
     QMap<QByteArray, QByteArray> requestHeaders() const;
     QIODevice *requestBody() const;
+    Priority priority() const;
 
     void reply(const QByteArray &contentType, QIODevice *device);
+    void reply(const QByteArray &contentType, const QByteArray &data);
     void fail(Error error);
     void redirect(const QUrl &url);
     void setAdditionalResponseHeaders(
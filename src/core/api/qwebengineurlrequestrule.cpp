@@ -0,0 +1,243 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebengineurlrequestrule.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWebEngineUrlRequestRule
+    \brief The QWebEngineUrlRequestRule class describes a declarative rule that
+    blocks, redirects or modifies matching URL requests.
+    \since 6.10
+
+    \inmodule QtWebEngineCore
+
+    Rules are installed on a profile with QWebEngineProfile::setUrlRequestRules().
+    They are compiled into a single matcher and evaluated for every request
+    before any QWebEngineUrlRequestInterceptor is called, without calling into
+    application code. This makes them suitable for content filtering with large
+    rule lists.
+
+    The URL pattern is matched against the whole URL, ignoring case. It uses the
+    syntax common to content-filtering lists:
+
+    \list
+    \li \c * matches any sequence of characters.
+    \li \c ^ matches a separator, which is any character other than a letter,
+        a digit, or one of \c{_-.%}, or the end of the URL.
+    \li A leading \c || anchors the pattern at the start of the host name or of
+        any of its subdomains. \c{||example.com^} matches \c{https://example.com/}
+        and \c{http://ads.example.com/banner.png}.
+    \li A leading \c | anchors the pattern at the start of the URL, and a
+        trailing \c | at its end.
+    \li Otherwise the pattern may match anywhere in the URL.
+    \endlist
+
+    A rule can be restricted to some resource types, and to first-party or
+    third-party requests. A request is third-party if its URL is not on the
+    same site as the top-level document.
+
+    When several rules match a request, an Action::Allow rule cancels matching
+    Action::Block and Action::Redirect rules. Otherwise blocking takes
+    precedence over redirecting, and the first matching redirect is used.
+    Header rules are applied in order unless the request is blocked or
+    redirected. Blocked requests fail with \c net::ERR_BLOCKED_BY_CLIENT.
+
+    \sa QWebEngineProfile::setUrlRequestRules()
+*/
+
+/*!
+    \enum QWebEngineUrlRequestRule::Action
+
+    This enum describes what happens to a request that matches the rule.
+
+    \value Block The request is blocked.
+    \value Allow Matching Block and Redirect rules do not apply to the request.
+    \value Redirect The request is redirected to redirectUrl().
+    \value SetHeader The request header headerName() is set to headerValue().
+    \value RemoveHeader The request header headerName() is removed.
+*/
+
+/*!
+    \enum QWebEngineUrlRequestRule::Party
+
+    This enum describes which requests the rule applies to, relative to the
+    top-level document.
+
+    \value Any All requests. This is the default.
+    \value FirstParty Requests for the site of the top-level document.
+    \value ThirdParty Requests for other sites.
+*/
+
+class QWebEngineUrlRequestRulePrivate : public QSharedData
+{
+public:
+    QString urlPattern;
+    QWebEngineUrlRequestRule::Action action = QWebEngineUrlRequestRule::Action::Block;
+    QList<QWebEngineUrlRequestInfo::ResourceType> resourceTypes;
+    QWebEngineUrlRequestRule::Party party = QWebEngineUrlRequestRule::Party::Any;
+    QUrl redirectUrl;
+    QByteArray headerName;
+    QByteArray headerValue;
+};
+
+QT_DEFINE_QSDP_SPECIALIZATION_DTOR(QWebEngineUrlRequestRulePrivate)
+
+/*!
+    Constructs a rule that blocks every request.
+*/
+QWebEngineUrlRequestRule::QWebEngineUrlRequestRule() : d(new QWebEngineUrlRequestRulePrivate) { }
+
+/*!
+    Constructs a rule that applies \a action to requests matching \a urlPattern.
+*/
+QWebEngineUrlRequestRule::QWebEngineUrlRequestRule(const QString &urlPattern, Action action)
+    : d(new QWebEngineUrlRequestRulePrivate)
+{
+    d->urlPattern = urlPattern;
+    d->action = action;
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QWebEngineUrlRequestRule::QWebEngineUrlRequestRule(const QWebEngineUrlRequestRule &other) = default;
+
+/*!
+    Assigns \a other to this rule.
+*/
+QWebEngineUrlRequestRule &
+QWebEngineUrlRequestRule::operator=(const QWebEngineUrlRequestRule &other) = default;
+
+/*!
+    Move-constructs a rule from \a other.
+*/
+QWebEngineUrlRequestRule::QWebEngineUrlRequestRule(QWebEngineUrlRequestRule &&other) noexcept =
+        default;
+
+/*!
+    Move-assigns \a other to this rule.
+*/
+QWebEngineUrlRequestRule &
+QWebEngineUrlRequestRule::operator=(QWebEngineUrlRequestRule &&other) noexcept = default;
+
+/*!
+    Destroys the rule.
+*/
+QWebEngineUrlRequestRule::~QWebEngineUrlRequestRule() = default;
+
+/*!
+    Returns the pattern matched against request URLs.
+*/
+QString QWebEngineUrlRequestRule::urlPattern() const
+{
+    return d->urlPattern;
+}
+
+/*!
+    Sets the pattern matched against request URLs to \a pattern. An empty
+    pattern matches every URL.
+*/
+void QWebEngineUrlRequestRule::setUrlPattern(const QString &pattern)
+{
+    d->urlPattern = pattern;
+}
+
+/*!
+    Returns the action applied to matching requests.
+*/
+QWebEngineUrlRequestRule::Action QWebEngineUrlRequestRule::action() const
+{
+    return d->action;
+}
+
+/*!
+    Sets the action applied to matching requests to \a action.
+*/
+void QWebEngineUrlRequestRule::setAction(Action action)
+{
+    d->action = action;
+}
+
+/*!
+    Returns the resource types the rule applies to. An empty list, the
+    default, means all resource types.
+*/
+QList<QWebEngineUrlRequestInfo::ResourceType> QWebEngineUrlRequestRule::resourceTypes() const
+{
+    return d->resourceTypes;
+}
+
+/*!
+    Restricts the rule to requests for resources of \a types.
+*/
+void QWebEngineUrlRequestRule::setResourceTypes(
+        const QList<QWebEngineUrlRequestInfo::ResourceType> &types)
+{
+    d->resourceTypes = types;
+}
+
+/*!
+    Returns whether the rule applies to first-party or third-party requests.
+*/
+QWebEngineUrlRequestRule::Party QWebEngineUrlRequestRule::party() const
+{
+    return d->party;
+}
+
+/*!
+    Restricts the rule to first-party or third-party requests, according to
+    \a party.
+*/
+void QWebEngineUrlRequestRule::setParty(Party party)
+{
+    d->party = party;
+}
+
+/*!
+    Returns the URL that Action::Redirect rules redirect to.
+*/
+QUrl QWebEngineUrlRequestRule::redirectUrl() const
+{
+    return d->redirectUrl;
+}
+
+/*!
+    Sets the URL that Action::Redirect rules redirect to, to \a url.
+*/
+void QWebEngineUrlRequestRule::setRedirectUrl(const QUrl &url)
+{
+    d->redirectUrl = url;
+}
+
+/*!
+    Returns the name of the header that Action::SetHeader and
+    Action::RemoveHeader rules modify.
+*/
+QByteArray QWebEngineUrlRequestRule::headerName() const
+{
+    return d->headerName;
+}
+
+/*!
+    Returns the value that Action::SetHeader rules set.
+*/
+QByteArray QWebEngineUrlRequestRule::headerValue() const
+{
+    return d->headerValue;
+}
+
+/*!
+    Sets the header modified by Action::SetHeader and Action::RemoveHeader
+    rules to \a name, and the value set by Action::SetHeader to \a value.
+*/
+void QWebEngineUrlRequestRule::setHeader(const QByteArray &name, const QByteArray &value)
+{
+    d->headerName = name;
+    d->headerValue = value;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qwebengineurlrequestrule.cpp"
@@ -0,0 +1,66 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLREQUESTRULE_H
+#define QWEBENGINEURLREQUESTRULE_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebengineurlrequestinfo.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qurl.h>
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineUrlRequestRulePrivate;
+QT_DECLARE_QSDP_SPECIALIZATION_DTOR_WITH_EXPORT(QWebEngineUrlRequestRulePrivate,
+                                                Q_WEBENGINECORE_EXPORT)
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlRequestRule
+{
+    Q_GADGET
+public:
+    enum class Action { Block, Allow, Redirect, SetHeader, RemoveHeader };
+    Q_ENUM(Action)
+
+    enum class Party { Any, FirstParty, ThirdParty };
+    Q_ENUM(Party)
+
+    QWebEngineUrlRequestRule();
+    QWebEngineUrlRequestRule(const QString &urlPattern, Action action);
+    QWebEngineUrlRequestRule(const QWebEngineUrlRequestRule &other);
+    QWebEngineUrlRequestRule &operator=(const QWebEngineUrlRequestRule &other);
+    QWebEngineUrlRequestRule(QWebEngineUrlRequestRule &&other) noexcept;
+    QWebEngineUrlRequestRule &operator=(QWebEngineUrlRequestRule &&other) noexcept;
+    ~QWebEngineUrlRequestRule();
+
+    QString urlPattern() const;
+    void setUrlPattern(const QString &pattern);
+
+    Action action() const;
+    void setAction(Action action);
+
+    QList<QWebEngineUrlRequestInfo::ResourceType> resourceTypes() const;
+    void setResourceTypes(const QList<QWebEngineUrlRequestInfo::ResourceType> &types);
+
+    Party party() const;
+    void setParty(Party party);
+
+    QUrl redirectUrl() const;
+    void setRedirectUrl(const QUrl &url);
+
+    QByteArray headerName() const;
+    QByteArray headerValue() const;
+    void setHeader(const QByteArray &name, const QByteArray &value = QByteArray());
+
+private:
+    QSharedDataPointer<QWebEngineUrlRequestRulePrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLREQUESTRULE_H
@@ -0,0 +1,160 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebengineurlresponseinfo.h"
+#include "qwebengineurlresponseinfo_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWebEngineUrlResponseBodyTransformer
+    \inmodule QtWebEngineCore
+    \since 6.10
+    \brief The QWebEngineUrlResponseBodyTransformer class rewrites a response body as it streams.
+
+    Set an instance with QWebEngineUrlResponseInfo::setBodyTransformer() to
+    rewrite the body of one response. The body is handed to transform() in
+    chunks, in order, as it arrives from the network, and whatever it returns
+    is passed on to the page in its place. Once the whole body has been seen,
+    finish() can flush any output that was held back, such as the end of a
+    match that spanned two chunks.
+
+    The transformer runs on a worker thread, not on the thread of the
+    interceptor, and it is deleted there once the body is done or the request
+    is cancelled. Reading the body waits while the page is not consuming the
+    output, so only the chunk being transformed is held in memory. Never
+    collecting the whole body keeps the memory use of large responses flat;
+    a transformer that needs more context has to keep it itself.
+
+    \sa QWebEngineUrlResponseInterceptor
+*/
+
+/*!
+    Destroys the transformer.
+*/
+QWebEngineUrlResponseBodyTransformer::~QWebEngineUrlResponseBodyTransformer() = default;
+
+/*!
+    \fn QByteArray QWebEngineUrlResponseBodyTransformer::transform(QByteArrayView chunk)
+
+    Returns the data to pass on in place of \a chunk, the next part of the
+    response body. The view is only valid during the call.
+*/
+
+/*!
+    Returns the data to append after the transformed body, once the last
+    chunk has been passed to transform(). The default implementation returns
+    nothing.
+*/
+QByteArray QWebEngineUrlResponseBodyTransformer::finish()
+{
+    return QByteArray();
+}
+
+/*!
+    \class QWebEngineUrlResponseInfo
+    \inmodule QtWebEngineCore
+    \since 6.10
+    \brief The QWebEngineUrlResponseInfo class provides information about a URL response.
+
+    QWebEngineUrlResponseInfo is passed to
+    QWebEngineUrlResponseInterceptor::interceptResponse() when the headers of a
+    response arrive, before the page sees them. It can change the response
+    headers and attach a QWebEngineUrlResponseBodyTransformer to rewrite the
+    body.
+
+    This class cannot be instantiated or copied by the user.
+*/
+
+QWebEngineUrlResponseInfoPrivate::QWebEngineUrlResponseInfoPrivate(
+        const QUrl &url, QWebEngineUrlRequestInfo::ResourceType resourceType, int statusCode,
+        const QMultiHash<QByteArray, QByteArray> &headers)
+    : url(url), resourceType(resourceType), statusCode(statusCode), headers(headers)
+{
+}
+
+/*!
+    \internal
+*/
+QWebEngineUrlResponseInfo::QWebEngineUrlResponseInfo(QWebEngineUrlResponseInfoPrivate *p)
+    : d_ptr(p)
+{
+}
+
+/*!
+    \internal
+*/
+QWebEngineUrlResponseInfo::~QWebEngineUrlResponseInfo() = default;
+
+/*!
+    Returns the URL of the request the response belongs to.
+*/
+QUrl QWebEngineUrlResponseInfo::requestUrl() const
+{
+    Q_D(const QWebEngineUrlResponseInfo);
+    return d->url;
+}
+
+/*!
+    Returns the resource type of the request the response belongs to.
+*/
+QWebEngineUrlRequestInfo::ResourceType QWebEngineUrlResponseInfo::resourceType() const
+{
+    Q_D(const QWebEngineUrlResponseInfo);
+    return d->resourceType;
+}
+
+/*!
+    Returns the HTTP status code of the response, or 0 if the response did
+    not come with one.
+*/
+int QWebEngineUrlResponseInfo::statusCode() const
+{
+    Q_D(const QWebEngineUrlResponseInfo);
+    return d->statusCode;
+}
+
+/*!
+    Returns the headers of the response, including the changes made so far.
+*/
+QMultiHash<QByteArray, QByteArray> QWebEngineUrlResponseInfo::responseHeaders() const
+{
+    Q_D(const QWebEngineUrlResponseInfo);
+    return d->headers;
+}
+
+/*!
+    Sets the response header \a name to \a value, replacing any existing
+    header of that name.
+*/
+void QWebEngineUrlResponseInfo::setResponseHeader(const QByteArray &name, const QByteArray &value)
+{
+    Q_D(QWebEngineUrlResponseInfo);
+    d->headers.remove(name);
+    d->headers.insert(name, value);
+    d->headerChanges.append({ name, value });
+}
+
+/*!
+    Removes all response headers called \a name.
+*/
+void QWebEngineUrlResponseInfo::removeResponseHeader(const QByteArray &name)
+{
+    Q_D(QWebEngineUrlResponseInfo);
+    d->headers.remove(name);
+    d->headerChanges.append({ name, std::nullopt });
+}
+
+/*!
+    Rewrites the body of the response with \a transformer, which is then
+    owned by \QWE. Setting a transformer drops the \c Content-Length header,
+    since the length of the body is no longer known in advance. Passing
+    \c nullptr leaves the body as it is.
+*/
+void QWebEngineUrlResponseInfo::setBodyTransformer(QWebEngineUrlResponseBodyTransformer *transformer)
+{
+    Q_D(QWebEngineUrlResponseInfo);
+    d->bodyTransformer.reset(transformer);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,57 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLRESPONSEINFO_H
+#define QWEBENGINEURLRESPONSEINFO_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebengineurlrequestinfo.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qurl.h>
+
+#include <memory>
+
+namespace QtWebEngineCore {
+class InterceptedRequest;
+} // namespace QtWebEngineCore
+
+QT_BEGIN_NAMESPACE
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlResponseBodyTransformer
+{
+public:
+    virtual ~QWebEngineUrlResponseBodyTransformer();
+    virtual QByteArray transform(QByteArrayView chunk) = 0;
+    virtual QByteArray finish();
+};
+
+class QWebEngineUrlResponseInfoPrivate;
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlResponseInfo
+{
+public:
+    QUrl requestUrl() const;
+    QWebEngineUrlRequestInfo::ResourceType resourceType() const;
+    int statusCode() const;
+    QMultiHash<QByteArray, QByteArray> responseHeaders() const;
+
+    void setResponseHeader(const QByteArray &name, const QByteArray &value);
+    void removeResponseHeader(const QByteArray &name);
+    void setBodyTransformer(QWebEngineUrlResponseBodyTransformer *transformer);
+
+private:
+    friend class QtWebEngineCore::InterceptedRequest;
+    Q_DISABLE_COPY(QWebEngineUrlResponseInfo)
+    Q_DECLARE_PRIVATE(QWebEngineUrlResponseInfo)
+
+    QWebEngineUrlResponseInfo(QWebEngineUrlResponseInfoPrivate *p);
+    ~QWebEngineUrlResponseInfo();
+    std::unique_ptr<QWebEngineUrlResponseInfoPrivate> d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLRESPONSEINFO_H
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLRESPONSEINFO_P_H
+#define QWEBENGINEURLRESPONSEINFO_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qtwebenginecoreglobal_p.h"
+
+#include "qwebengineurlresponseinfo.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QUrl>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlResponseInfoPrivate
+{
+public:
+    QWebEngineUrlResponseInfoPrivate(const QUrl &url,
+                                     QWebEngineUrlRequestInfo::ResourceType resourceType,
+                                     int statusCode, const QMultiHash<QByteArray, QByteArray> &headers);
+
+    const QUrl url;
+    const QWebEngineUrlRequestInfo::ResourceType resourceType;
+    const int statusCode;
+    QMultiHash<QByteArray, QByteArray> headers;
+    // Header changes in call order, with no value for a removal.
+    QList<std::pair<QByteArray, std::optional<QByteArray>>> headerChanges;
+    std::unique_ptr<QWebEngineUrlResponseBodyTransformer> bodyTransformer;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLRESPONSEINFO_P_H
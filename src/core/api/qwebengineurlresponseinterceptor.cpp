@@ -0,0 +1,47 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qwebengineurlresponseinterceptor.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWebEngineUrlResponseInterceptor
+    \inmodule QtWebEngineCore
+    \since 6.10
+    \brief The QWebEngineUrlResponseInterceptor class provides an abstract base class for response interception.
+
+    Implementing the QWebEngineUrlResponseInterceptor interface and installing
+    it with QWebEngineProfile::setUrlResponseInterceptor() makes it possible to
+    change the headers of responses and to rewrite their bodies while they
+    stream to the page, without proxying the requests through a server.
+
+    Only requests that pass through the request interception stage are
+    seen, which covers all network requests of the profile's pages.
+
+    \sa interceptResponse(), QWebEngineUrlResponseInfo,
+    QWebEngineUrlResponseBodyTransformer, QWebEngineUrlRequestInterceptor
+*/
+
+/*!
+    \fn QWebEngineUrlResponseInterceptor::QWebEngineUrlResponseInterceptor(QObject *p = nullptr)
+
+    Creates a new QWebEngineUrlResponseInterceptor object with \a p as parent.
+*/
+
+/*!
+    \fn void QWebEngineUrlResponseInterceptor::interceptResponse(QWebEngineUrlResponseInfo &info)
+
+    Reimplementing this virtual function makes it possible to intercept URL
+    responses. It is called on the UI thread when the headers of a response
+    arrive, and the response stalls until it returns.
+
+    \a info describes the response. Header changes and a body transformer set
+    on it are applied before the response is passed on to the page.
+*/
+
+QWebEngineUrlResponseInterceptor::~QWebEngineUrlResponseInterceptor() = default;
+
+QT_END_NAMESPACE
+
+#include "moc_qwebengineurlresponseinterceptor.cpp"
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLRESPONSEINTERCEPTOR_H
+#define QWEBENGINEURLRESPONSEINTERCEPTOR_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebengineurlresponseinfo.h>
+
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlResponseInterceptor : public QObject
+{
+    Q_OBJECT
+public:
+    explicit QWebEngineUrlResponseInterceptor(QObject *p = nullptr) : QObject(p) {}
+    ~QWebEngineUrlResponseInterceptor() override;
+    virtual void interceptResponse(QWebEngineUrlResponseInfo &info) = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLRESPONSEINTERCEPTOR_H
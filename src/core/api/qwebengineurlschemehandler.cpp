@@ -2,11 +2,46 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qwebengineurlschemehandler.h"
+#include "qwebengineurlschemehandler_p.h"
 
+#include "net/url_scheme_response_cache.h"
 #include "qwebengineurlrequestjob.h"
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
+using QtWebEngineCore::UrlSchemeHandlerAccess;
+using QtWebEngineCore::UrlSchemeResponseCache;
+
+std::shared_ptr<UrlSchemeHandlerAccess> QWebEngineUrlSchemeHandlerPrivate::threadPoolAccess()
+{
+    Q_Q(QWebEngineUrlSchemeHandler);
+    if (!access) {
+        access = std::make_shared<UrlSchemeHandlerAccess>();
+        access->handler = q;
+    }
+    return access;
+}
+
+std::shared_ptr<UrlSchemeResponseCache> QWebEngineUrlSchemeHandlerPrivate::createResponseCache()
+{
+    std::erase_if(responseCaches, [](const auto &cache) { return cache.expired(); });
+    auto cache = std::make_shared<UrlSchemeResponseCache>(responseCacheSize);
+    responseCaches.push_back(cache);
+    return cache;
+}
+
+// Requests that have not reached the handler yet fail instead of calling it.
+void QWebEngineUrlSchemeHandlerPrivate::revokeThreadPoolAccess()
+{
+    if (!access)
+        return;
+    QWriteLocker locker(&access->lock);
+    access->handler = nullptr;
+    access.reset();
+}
+
 /*!
     \class QWebEngineUrlSchemeHandler
     \brief The QWebEngineUrlSchemeHandler class is a base class for handling custom URL schemes.
@@ -81,11 +116,32 @@ QT_BEGIN_NAMESPACE
     }
     \endcode
 
+    By default, requestStarted() is called on the UI thread. A handler that serves
+    many requests can set its threadingMode() to ThreadingMode::ThreadPool to have
+    requests started on a few worker threads instead. With setPrioritizedScheduling(),
+    requests that block rendering are started ahead of images and prefetches.
+
+    Handlers serving resources that do not change often can enable a response
+    cache with setResponseCacheSize(). Repeated requests for the same URL are
+    then answered from memory without calling requestStarted().
+
     \inmodule QtWebEngineCore
 
     \sa {QWebEngineUrlScheme}
 */
 
+/*!
+    \enum QWebEngineUrlSchemeHandler::ThreadingMode
+    \since 6.10
+
+    This enum describes the thread on which requestStarted() is called.
+
+    \value UiThread The handler is called on the UI thread. This is the default.
+    \value ThreadPool The handler is called on one of a few worker threads, possibly
+    for several requests at the same time. All calls for a request are made on
+    the same thread.
+*/
+
 /*!
     Constructs a new URL scheme handler.
 
@@ -93,7 +149,7 @@ QT_BEGIN_NAMESPACE
 
   */
 QWebEngineUrlSchemeHandler::QWebEngineUrlSchemeHandler(QObject *parent)
-    : QObject(parent)
+    : QObject(*new QWebEngineUrlSchemeHandlerPrivate, parent)
 {
 }
 
@@ -102,6 +158,202 @@ QWebEngineUrlSchemeHandler::QWebEngineUrlSchemeHandler(QObject *parent)
 */
 QWebEngineUrlSchemeHandler::~QWebEngineUrlSchemeHandler()
 {
+    Q_D(QWebEngineUrlSchemeHandler);
+    d->revokeThreadPoolAccess();
+}
+
+/*!
+    \since 6.10
+
+    Returns the thread on which requestStarted() is called.
+
+    \sa setThreadingMode()
+*/
+QWebEngineUrlSchemeHandler::ThreadingMode QWebEngineUrlSchemeHandler::threadingMode() const
+{
+    Q_D(const QWebEngineUrlSchemeHandler);
+    return d->threadingMode;
+}
+
+/*!
+    \since 6.10
+
+    Sets the thread on which requestStarted() is called to \a mode.
+
+    With ThreadingMode::ThreadPool, requestStarted() must be thread-safe. The
+    QWebEngineUrlRequestJob belongs to the worker thread it was started on, and can
+    be replied to, redirected or failed from there. When the request ends, the job
+    is deleted on the same thread, along with objects parented to it, such as the
+    reply device.
+
+    The worker threads do not run a Qt event loop. Objects living on them do not
+    receive queued signals, timer events or deferred deletes, so a reply device
+    that is filled asynchronously must be moved to a thread that runs an event
+    loop.
+
+    Removing the handler from a profile waits for calls of requestStarted() in
+    progress, and requests that have not reached the handler yet fail. The
+    handler must therefore be removed from all profiles before it is deleted,
+    and requestStarted() must not wait for the UI thread.
+
+    The mode applies to requests started after this call. This function must be
+    called on the UI thread.
+
+    \sa threadingMode()
+*/
+void QWebEngineUrlSchemeHandler::setThreadingMode(ThreadingMode mode)
+{
+    Q_D(QWebEngineUrlSchemeHandler);
+    d->threadingMode = mode;
+}
+
+/*!
+    \since 6.10
+
+    Returns whether requests are started in order of their priority.
+
+    \sa setPrioritizedScheduling()
+*/
+bool QWebEngineUrlSchemeHandler::prioritizedScheduling() const
+{
+    Q_D(const QWebEngineUrlSchemeHandler);
+    return d->prioritizedScheduling;
+}
+
+/*!
+    \since 6.10
+
+    Sets whether requests are started in order of their priority to \a enabled.
+    This is disabled by default, and requests are started in the order they are
+    made.
+
+    When enabled, requestStarted() is called for requests that block rendering,
+    such as stylesheets and scripts, ahead of pending requests with a lower
+    priority, such as images and prefetches. Requests for prefetches are only
+    started when the thread is otherwise idle. A request is scheduled with the
+    priority it has when it is made; later priority changes do not reschedule
+    it and are only reported by QWebEngineUrlRequestJob::priority().
+
+    The setting applies to requests made after this call. This function must be
+    called on the UI thread.
+
+    \sa QWebEngineUrlRequestJob::priority()
+*/
+void QWebEngineUrlSchemeHandler::setPrioritizedScheduling(bool enabled)
+{
+    Q_D(QWebEngineUrlSchemeHandler);
+    d->prioritizedScheduling = enabled;
+}
+
+/*!
+    \since 6.10
+
+    Returns whether the request body of jobs is streamed.
+
+    \sa setRequestBodyStreaming()
+*/
+bool QWebEngineUrlSchemeHandler::requestBodyStreaming() const
+{
+    Q_D(const QWebEngineUrlSchemeHandler);
+    return d->requestBodyStreaming;
+}
+
+/*!
+    \since 6.10
+
+    Sets whether the request body of jobs is streamed to \a enabled. This is
+    disabled by default, and reads from QWebEngineUrlRequestJob::requestBody()
+    wait for data that has not been uploaded yet.
+
+    When enabled, reads return the data that is available without waiting, and
+    QIODevice::readyRead() is emitted when more data arrives. The handler must
+    then read the request body asynchronously.
+
+    The setting applies to requests made after this call. This function must be
+    called on the UI thread.
+
+    \sa QWebEngineUrlRequestJob::requestBody()
+*/
+void QWebEngineUrlSchemeHandler::setRequestBodyStreaming(bool enabled)
+{
+    Q_D(QWebEngineUrlSchemeHandler);
+    d->requestBodyStreaming = enabled;
+}
+
+/*!
+    \since 6.10
+
+    Returns the maximum size in bytes of the response cache, or \c 0 if
+    responses are not cached. This is the default.
+
+    \sa setResponseCacheSize()
+*/
+qint64 QWebEngineUrlSchemeHandler::responseCacheSize() const
+{
+    Q_D(const QWebEngineUrlSchemeHandler);
+    return d->responseCacheSize;
+}
+
+/*!
+    \since 6.10
+
+    Sets the maximum size in bytes of the response cache to \a size. A size
+    of \c 0 disables the cache and drops all cached responses.
+
+    When the cache is enabled, complete responses to \c GET requests are kept
+    in memory and later requests for the same URL are answered from the cache,
+    including byte range requests. A response is cached according to the
+    headers set with QWebEngineUrlRequestJob::setAdditionalResponseHeaders():
+
+    \list
+    \li \c{Cache-Control: no-store} or \c{no-cache} prevents caching, and
+        \c{max-age} limits how long the response is reused. Responses without
+        \c Cache-Control are reused until the cache is cleared.
+    \li The response is only reused for requests with the same values of the
+        request headers listed in \c Vary.
+    \li If the response has an \c ETag, a request whose \c If-None-Match header
+        matches it is answered with \c{304 Not Modified}.
+    \endlist
+
+    Responses that are larger than an eighth of the cache size are not cached.
+    Redirects and failures are never cached.
+
+    Each profile the handler is installed in keeps its own cache of this size.
+    QWebEngineProfile::clearHttpCache() drops the responses cached for that
+    profile.
+
+    \sa clearResponseCache()
+*/
+void QWebEngineUrlSchemeHandler::setResponseCacheSize(qint64 size)
+{
+    Q_D(QWebEngineUrlSchemeHandler);
+    d->responseCacheSize = std::max(size, qint64(0));
+    for (const std::weak_ptr<UrlSchemeResponseCache> &weakCache : d->responseCaches) {
+        if (std::shared_ptr<UrlSchemeResponseCache> cache = weakCache.lock()) {
+            // Profiles stop using a disabled cache with their next request.
+            if (size <= 0)
+                cache->clear();
+            else
+                cache->setMaximumSize(size);
+        }
+    }
+}
+
+/*!
+    \since 6.10
+
+    Drops all cached responses in all profiles, so that the next requests reach
+    requestStarted().
+
+    \sa setResponseCacheSize(), QWebEngineProfile::clearHttpCache()
+*/
+void QWebEngineUrlSchemeHandler::clearResponseCache()
+{
+    Q_D(QWebEngineUrlSchemeHandler);
+    for (const std::weak_ptr<UrlSchemeResponseCache> &weakCache : d->responseCaches) {
+        if (std::shared_ptr<UrlSchemeResponseCache> cache = weakCache.lock())
+            cache->clear();
+    }
 }
 
 /*!
@@ -112,6 +364,8 @@ QWebEngineUrlSchemeHandler::~QWebEngineUrlSchemeHandler()
     This method must be reimplemented by all custom URL scheme handlers.
     The request is asynchronous and does not need to be handled right away.
 
+    The thread this method is called on depends on threadingMode().
+
     \sa QWebEngineUrlRequestJob
 */
 
@@ -11,17 +11,35 @@
 QT_BEGIN_NAMESPACE
 
 class QWebEngineUrlRequestJob;
+class QWebEngineUrlSchemeHandlerPrivate;
 
 class Q_WEBENGINECORE_EXPORT QWebEngineUrlSchemeHandler : public QObject
 {
     Q_OBJECT
 public:
+    enum class ThreadingMode { UiThread, ThreadPool };
+    Q_ENUM(ThreadingMode)
+
     QWebEngineUrlSchemeHandler(QObject *parent = nullptr);
     ~QWebEngineUrlSchemeHandler();
 
+    ThreadingMode threadingMode() const;
+    void setThreadingMode(ThreadingMode mode);
+
+    bool prioritizedScheduling() const;
+    void setPrioritizedScheduling(bool enabled);
+
+    bool requestBodyStreaming() const;
+    void setRequestBodyStreaming(bool enabled);
+
+    qint64 responseCacheSize() const;
+    void setResponseCacheSize(qint64 size);
+    void clearResponseCache();
+
     virtual void requestStarted(QWebEngineUrlRequestJob *) = 0;
 
 private:
+    Q_DECLARE_PRIVATE(QWebEngineUrlSchemeHandler)
     Q_DISABLE_COPY(QWebEngineUrlSchemeHandler)
 };
 
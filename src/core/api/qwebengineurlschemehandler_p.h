@@ -0,0 +1,69 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QWEBENGINEURLSCHEMEHANDLER_P_H
+#define QWEBENGINEURLSCHEMEHANDLER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qtwebenginecoreglobal_p.h"
+#include "qwebengineurlschemehandler.h"
+
+#include <QtCore/private/qobject_p.h>
+#include <QtCore/qreadwritelock.h>
+
+#include <memory>
+#include <vector>
+
+namespace QtWebEngineCore {
+class UrlSchemeResponseCache;
+
+// Gives worker threads access to a handler in the ThreadPool threading mode.
+// Worker threads call the handler under the read lock, and the UI thread
+// clears the pointer under the write lock, which waits for calls in progress.
+struct UrlSchemeHandlerAccess
+{
+    QReadWriteLock lock;
+    QWebEngineUrlSchemeHandler *handler;
+};
+}
+
+QT_BEGIN_NAMESPACE
+
+class Q_WEBENGINECORE_EXPORT QWebEngineUrlSchemeHandlerPrivate : public QObjectPrivate
+{
+public:
+    static QWebEngineUrlSchemeHandlerPrivate *get(QWebEngineUrlSchemeHandler *q)
+    {
+        return q->d_func();
+    }
+
+    std::shared_ptr<QtWebEngineCore::UrlSchemeHandlerAccess> threadPoolAccess();
+    void revokeThreadPoolAccess();
+    std::shared_ptr<QtWebEngineCore::UrlSchemeResponseCache> createResponseCache();
+
+    QWebEngineUrlSchemeHandler::ThreadingMode threadingMode =
+            QWebEngineUrlSchemeHandler::ThreadingMode::UiThread;
+    // Shared with the pending requests of a handler in the ThreadPool mode, created
+    // on demand and replaced when revoked. Only accessed on the UI thread.
+    std::shared_ptr<QtWebEngineCore::UrlSchemeHandlerAccess> access;
+    bool prioritizedScheduling = false;
+    bool requestBodyStreaming = false;
+    qint64 responseCacheSize = 0;
+    // The caches owned by the profiles the handler is installed in, which are
+    // resized and cleared along with the handler's settings.
+    std::vector<std::weak_ptr<QtWebEngineCore::UrlSchemeResponseCache>> responseCaches;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEURLSCHEMEHANDLER_P_H
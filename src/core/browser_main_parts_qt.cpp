@@ -3,6 +3,7 @@
 
 #include "browser_main_parts_qt.h"
 
+#include "api/qwebengineglobalsettings_p.h"
 #include "api/qwebenginemessagepumpscheduler_p.h"
 
 #include "base/message_loop/message_pump.h"
@@ -52,9 +53,14 @@
 #include "web_usb_detector_qt.h"
 
 #include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QLoggingCategory>
 #include <QtGui/qtgui-config.h>
+#include <QtGui/qpa/qwindowsysteminterface.h>
 #include <QStandardPaths>
 
+#include <algorithm>
+
 #if BUILDFLAG(IS_MAC)
 #include "base/message_loop/message_pump_apple.h"
 #include "services/device/public/cpp/geolocation/geolocation_system_permission_manager.h"
@@ -75,22 +81,23 @@
 
 namespace QtWebEngineCore {
 
+Q_WEBENGINE_LOGGING_CATEGORY(lcWebEngineMessagePump, "qt.webengine.messagepump")
+
 namespace {
 
-// Return a timeout suitable for the glib loop, -1 to block forever,
-// 0 to return right away, or a timeout in milliseconds from now.
-int GetTimeIntervalMilliseconds(const base::TimeTicks &from)
+// Return a timeout suitable for the scheduler, negative to block forever,
+// zero to return right away, or a timeout in microseconds from now.
+std::chrono::microseconds GetTimeInterval(const base::TimeTicks &from)
 {
     if (from.is_null())
-        return -1;
+        return std::chrono::microseconds(-1);
 
-    // Be careful here.  TimeDelta has a precision of microseconds, but we want a
-    // value in milliseconds.  If there are 5.5ms left, should the delay be 5 or
-    // 6?  It should be 6 to avoid executing delayed work too early.
-    int delay = static_cast<int>(std::ceil((from - base::TimeTicks::Now()).InMillisecondsF()));
+    // TimeDelta has a precision of microseconds, which the scheduler rounds up
+    // to its own timer precision, to avoid executing delayed work too early.
+    const int64_t delay = (from - base::TimeTicks::Now()).InMicroseconds();
 
     // If this value is negative, then we need to run delayed work soon.
-    return delay < 0 ? 0 : delay;
+    return std::chrono::microseconds(delay < 0 ? 0 : delay);
 }
 
 }  // anonymous namespace
@@ -130,7 +137,7 @@ public:
     void ScheduleDelayedWork(const base::TimeTicks &delayed_work_time)
     {
         ensureDelegate();
-        m_scheduler.scheduleDelayedWork(GetTimeIntervalMilliseconds(delayed_work_time));
+        m_scheduler.scheduleDelayedWork(GetTimeInterval(delayed_work_time));
     }
 
 private:
@@ -143,23 +150,91 @@ private:
         }
     }
 
+    // Adapts the time slice for Chromium tasks to how busy the Qt side is: queued
+    // input events cut it to the minimum, a yield that took Qt longer than our own
+    // slice halves it, and a yield that Qt handed back promptly doubles it. Unless
+    // the application set a range with setWorkBudget(), the slice stays fixed.
+    std::chrono::nanoseconds nextWorkBudget()
+    {
+        QWebEngineGlobalSettingsPrivate *settings = QWebEngineGlobalSettingsPrivate::instance();
+        const QWebEngineGlobalSettings::WorkBudget policy = settings->workBudget;
+        std::chrono::nanoseconds budget = settings->currentWorkBudget;
+        if (policy.minimum == policy.maximum)
+            budget = policy.minimum;
+        else if (QWindowSystemInterface::windowSystemEventsQueued() > 0)
+            budget = policy.minimum;
+        else if (m_yieldTimer.isValid())
+            budget = m_yieldTimer.durationElapsed() > budget ? budget / 2 : budget * 2;
+        m_yieldTimer.invalidate();
+
+        settings->currentWorkBudget =
+                std::clamp<std::chrono::nanoseconds>(budget, policy.minimum, policy.maximum);
+        return settings->currentWorkBudget;
+    }
+
+    // Buckets grow by powers of two, the first one holding everything below 1.
+    static int histogramBucket(qint64 value)
+    {
+        int bucket = 0;
+        while (value > 0 && bucket < MessagePumpStatistics::kHistogramBuckets - 1) {
+            value >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
     void handleScheduledWork()
     {
-        QDeadlineTimer timer(std::chrono::milliseconds(2));
+        MessagePumpStatistics &statistics =
+                QWebEngineGlobalSettingsPrivate::instance()->messagePumpStatistics;
+        const qint64 queueDelay =
+                std::chrono::duration_cast<std::chrono::microseconds>(m_scheduler.queueDelay())
+                        .count();
+        ++statistics.slices;
+        statistics.totalQueueDelay += queueDelay;
+        statistics.maxQueueDelay = std::max(statistics.maxQueueDelay, queueDelay);
+        ++statistics.queueDelayHistogram[histogramBucket(queueDelay / 1000)];
+        if (queueDelay > kLongQueueDelay)
+            qCDebug(lcWebEngineMessagePump, "Qt delayed Chromium work by %lld us", queueDelay);
+
+        QElapsedTimer workTimer;
+        workTimer.start();
+        QDeadlineTimer timer(nextWorkBudget());
+        int iterations = 1;
         base::MessagePump::Delegate::NextWorkInfo more_work_info = m_delegate->DoWork();
-        while (more_work_info.is_immediate() && !timer.hasExpired())
+        while (more_work_info.is_immediate() && !timer.hasExpired()) {
             more_work_info = m_delegate->DoWork();
+            ++iterations;
+        }
 
-        if (more_work_info.is_immediate())
+        const qint64 workTime = workTimer.nsecsElapsed() / 1000;
+        statistics.workIterations += iterations;
+        statistics.workTime += workTime;
+        ++statistics.workIterationsHistogram[histogramBucket(iterations / 2)];
+
+        if (more_work_info.is_immediate()) {
+            ++statistics.expiredSlices;
+            qCDebug(lcWebEngineMessagePump,
+                    "Chromium work yielded with tasks pending after %d iterations in %lld us",
+                    iterations, workTime);
+            m_yieldTimer.start();
             return m_scheduler.scheduleImmediateWork();
+        }
 
+        workTimer.restart();
         m_delegate->DoIdleWork();
+        statistics.idleWorkTime += workTimer.nsecsElapsed() / 1000;
 
         ScheduleDelayedWork(more_work_info.delayed_run_time);
     }
 
+    // Queue delays longer than a frame at 60 Hz are logged.
+    static constexpr qint64 kLongQueueDelay = 16000;
+
     Delegate *m_delegate = nullptr;
     QWebEngineMessagePumpScheduler m_scheduler;
+    // Measures how long Qt keeps control after we yielded with work left.
+    QElapsedTimer m_yieldTimer;
 };
 
 #if BUILDFLAG(IS_MAC)
@@ -8,6 +8,7 @@
 
 #include <QGuiApplication>
 #include <QHash>
+#include <QImage>
 #include <QMutex>
 #include <QQuickWindow>
 
@@ -39,6 +40,7 @@ struct Compositor::Binding
     const Id id;
     Compositor *compositor = nullptr;
     Observer *observer = nullptr;
+    FrameSink *frameSink = nullptr;
 
     Binding(Id id) : id(id) { }
     ~Binding();
@@ -59,6 +61,8 @@ public:
         return *it;
     }
 
+    Binding *find(Id id) const { return m_map.value(id); }
+
     void remove(Id id) { m_map.remove(id); }
 
 private:
@@ -111,6 +115,26 @@ Compositor::Observer::~Observer()
 
 // Compositor
 
+// static
+Compositor::Handle<Compositor> Compositor::find(Id id)
+{
+    g_bindings.lock();
+    Binding *binding = g_bindings.find(id);
+    if (binding && binding->compositor)
+        return binding->compositor; // delay unlock
+    g_bindings.unlock();
+    return nullptr;
+}
+
+// static
+void Compositor::setFrameSink(Id id, FrameSink *sink)
+{
+    g_bindings.lock();
+    if (Binding *binding = g_bindings.find(id))
+        binding->frameSink = sink;
+    g_bindings.unlock();
+}
+
 void Compositor::bind(Id id)
 {
     DCHECK(!m_binding);
@@ -142,6 +166,15 @@ Compositor::Handle<Compositor::Observer> Compositor::observer()
     return nullptr;
 }
 
+Compositor::Handle<Compositor::FrameSink> Compositor::frameSink()
+{
+    g_bindings.lock();
+    if (m_binding && m_binding->frameSink)
+        return m_binding->frameSink; // delay unlock
+    g_bindings.unlock();
+    return nullptr;
+}
+
 void Compositor::waitForTexture()
 {
 }
@@ -160,8 +193,59 @@ bool Compositor::textureIsFlipped()
     Q_UNREACHABLE_RETURN(false);
 }
 
+bool Compositor::textureIsPersistent(QQuickWindow *)
+{
+    return false;
+}
+
+QList<Compositor::TextureTile> Compositor::textureTiles(QQuickWindow *, uint32_t)
+{
+    return {};
+}
+
 void Compositor::releaseResources() { }
 
+QImage Compositor::image(QRegion *)
+{
+    Q_UNREACHABLE_RETURN(QImage());
+}
+
+FrameStatistics Compositor::frameStatistics() const
+{
+    QMutexLocker locker(&m_statisticsMutex);
+    return m_statistics;
+}
+
+void Compositor::resetFrameStatistics()
+{
+    QMutexLocker locker(&m_statisticsMutex);
+    m_statistics = FrameStatistics();
+    m_pendingFrameTimer.invalidate();
+}
+
+void Compositor::recordFrameProduced(quint64 damagedPixelArea)
+{
+    QMutexLocker locker(&m_statisticsMutex);
+    ++m_statistics.framesProduced;
+    m_statistics.damagedPixelArea += damagedPixelArea;
+    // The previous frame was replaced before being presented.
+    if (m_pendingFrameTimer.isValid())
+        ++m_statistics.framesDropped;
+    m_pendingFrameTimer.start();
+}
+
+void Compositor::recordFramePresented()
+{
+    QMutexLocker locker(&m_statisticsMutex);
+    if (!m_pendingFrameTimer.isValid())
+        return;
+    const qint64 latency = m_pendingFrameTimer.nsecsElapsed() / 1000;
+    ++m_statistics.framesPresented;
+    m_statistics.totalPresentLatency += latency;
+    m_statistics.maxPresentLatency = std::max(m_statistics.maxPresentLatency, latency);
+    m_pendingFrameTimer.invalidate();
+}
+
 Compositor::Compositor(Type type) : m_type(type)
 {
     qCDebug(lcWebEngineCompositor, "Compositor Type: %s",
@@ -6,8 +6,15 @@
 
 #include <QtWebEngineCore/private/qtwebenginecoreglobal_p.h>
 
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qrect.h>
+
 QT_BEGIN_NAMESPACE
+class QImage;
 class QQuickWindow;
+class QRegion;
 class QSize;
 class QSGTexture;
 QT_END_NAMESPACE
@@ -20,6 +27,23 @@ namespace QtWebEngineCore {
 
 Q_DECLARE_LOGGING_CATEGORY(lcWebEngineCompositor);
 
+// Frame counters of a compositor.
+//
+// A frame is produced when viz finished drawing it and presented when
+// swapFrame() hands it to Qt. A produced frame that is replaced by a
+// newer one before being presented counts as dropped.
+struct FrameStatistics
+{
+    quint64 framesProduced = 0;
+    quint64 framesPresented = 0;
+    quint64 framesDropped = 0;
+    // Time from production to presentation, in microseconds.
+    qint64 totalPresentLatency = 0;
+    qint64 maxPresentLatency = 0;
+    // Sum of damaged areas of produced frames, in pixels.
+    quint64 damagedPixelArea = 0;
+};
+
 // Produces composited frames for display.
 //
 // Used by quick/widgets libraries for accessing the frames and
@@ -94,6 +118,27 @@ public:
         Binding *m_binding = nullptr;
     };
 
+    // Receives the frames produced by a compositor.
+    //
+    // Only the software compositor delivers frames.
+    class FrameSink
+    {
+    public:
+        // Called on the viz thread. The frame image is read-only and shares
+        // memory with the compositor's buffer.
+        virtual void frameProduced(const QImage &frame, const QRegion &damage) = 0;
+
+    protected:
+        ~FrameSink() = default;
+    };
+
+    // Compositor bound to the given id, if any.
+    static Handle<Compositor> find(Id id);
+
+    // Attaches a sink to the compositor with the given id, or detaches it
+    // when sink is null. The id must already be bound.
+    static void setFrameSink(Id id, FrameSink *sink);
+
     // Type determines which methods can be called.
     Type type() const { return m_type; }
 
@@ -130,13 +175,54 @@ public:
     // Is the texture produced upside down?
     virtual bool textureIsFlipped();
 
+    // Is the texture returned by texture() reused across frames?
+    //
+    // If so, texture() may return the same QSGTexture again after
+    // updating only its damaged regions, and the scene graph node
+    // holding it should be kept alive.
+    virtual bool textureIsPersistent(QQuickWindow *win);
+
+    // Part of the frame with a texture of its own.
+    struct TextureTile
+    {
+        QRect rect; // in pixels
+        QSGTexture *texture;
+    };
+
+    // Textures of the frame if it is split into tiles, otherwise empty
+    // and texture() is used instead.
+    //
+    // Tile textures are persistent, and each one belongs to the scene
+    // graph node it's set on. The same tile returns the same texture
+    // while the frame size stays in the same tile grid.
+    virtual QList<TextureTile> textureTiles(QQuickWindow *win, uint32_t textureOptions);
+
     // Release resources created in texture()
     virtual void releaseResources();
 
+    // Image of the frame, for painting without a scene graph.
+    //
+    // Only the software compositor provides images. If damage is given,
+    // it receives the parts of the image changed since the last call.
+    virtual QImage image(QRegion *damage = nullptr);
+
+    // Counters since creation or last reset, may be called from any thread.
+    FrameStatistics frameStatistics() const;
+    void resetFrameStatistics();
+
 protected:
     Compositor(Type type);
     virtual ~Compositor();
 
+    // Called by implementations when a new frame is ready, before readyToSwap().
+    void recordFrameProduced(quint64 damagedPixelArea);
+
+    // Called by implementations when swapFrame() picked up a new frame.
+    void recordFramePresented();
+
+    // Frame sink if attached.
+    Handle<FrameSink> frameSink();
+
 private:
     template<typename T>
     friend class Handle;
@@ -146,6 +232,10 @@ private:
 
     const Type m_type;
     Binding *m_binding = nullptr;
+
+    mutable QMutex m_statisticsMutex;
+    FrameStatistics m_statistics;
+    QElapsedTimer m_pendingFrameTimer;
 };
 
 } // namespace QtWebEngineCore
@@ -0,0 +1,122 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "compositor_frame_capture.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace QtWebEngineCore {
+
+static void copyRegion(const QImage &source, const QRegion &region, QImage &target)
+{
+    const int bytesPerPixel = source.depth() / 8;
+    const qsizetype stride = target.bytesPerLine();
+    uchar *bits = target.bits();
+    for (const QRect &rect : region) {
+        const qsizetype offset = qsizetype(rect.x()) * bytesPerPixel;
+        const size_t length = size_t(rect.width()) * bytesPerPixel;
+        for (int y = rect.top(); y <= rect.bottom(); ++y)
+            std::memcpy(bits + y * stride + offset, source.constScanLine(y) + offset, length);
+    }
+}
+
+CompositorFrameCapture::CompositorFrameCapture(Callback callback) : m_callback(std::move(callback))
+{
+    m_rateTimer.setSingleShot(true);
+    m_rateTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&m_rateTimer, &QTimer::timeout, this, [this]() { deliver(); });
+}
+
+CompositorFrameCapture::~CompositorFrameCapture()
+{
+    detach();
+}
+
+void CompositorFrameCapture::setMaximumFrameRate(qreal maximumFrameRate)
+{
+    m_maximumFrameRate = qMax(maximumFrameRate, qreal(0));
+}
+
+void CompositorFrameCapture::attach(Compositor::Id id)
+{
+    detach();
+    {
+        // Damage of another compositor does not apply to the frames copied so far.
+        QMutexLocker locker(&m_mutex);
+        m_buffer = QImage();
+    }
+    Compositor::setFrameSink(id, this);
+    m_id = id;
+}
+
+void CompositorFrameCapture::detach()
+{
+    // Blocks until a frameProduced() call in progress has returned.
+    if (m_id)
+        Compositor::setFrameSink(*m_id, nullptr);
+    m_id.reset();
+}
+
+void CompositorFrameCapture::frameProduced(const QImage &frame, const QRegion &damage)
+{
+    using namespace std::chrono;
+    const qint64 timestamp =
+            duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+
+    QMutexLocker locker(&m_mutex);
+    // |frame| aliases a buffer of the compositor and is only valid during this call.
+    if (m_buffer.size() != frame.size() || m_buffer.format() != frame.format()) {
+        m_buffer = frame.copy();
+        m_pendingDamage += frame.rect();
+    } else {
+        copyRegion(frame, damage & frame.rect(), m_buffer);
+        m_pendingDamage += damage;
+    }
+    m_framePending = true;
+    m_pendingTimestamp = timestamp;
+    if (m_deliveryScheduled)
+        return;
+    m_deliveryScheduled = true;
+    QMetaObject::invokeMethod(this, [this]() { scheduleDelivery(); }, Qt::QueuedConnection);
+}
+
+void CompositorFrameCapture::scheduleDelivery()
+{
+    if (m_maximumFrameRate > 0 && m_lastDelivery.isValid()) {
+        const qint64 interval = qint64(1000 / m_maximumFrameRate);
+        const qint64 elapsed = m_lastDelivery.elapsed();
+        if (elapsed < interval) {
+            m_rateTimer.start(interval - elapsed);
+            return;
+        }
+    }
+    deliver();
+}
+
+void CompositorFrameCapture::deliver()
+{
+    QImage frame;
+    QRegion damage;
+    qint64 timestamp;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_deliveryScheduled = false;
+        if (m_framePending)
+            frame = m_buffer;
+        m_framePending = false;
+        damage = std::move(m_pendingDamage);
+        m_pendingDamage = QRegion();
+        timestamp = m_pendingTimestamp;
+    }
+    if (frame.isNull())
+        return;
+
+    if (frame.size() != m_lastDeliveredSize)
+        damage = QRect(QPoint(), frame.size());
+    m_lastDeliveredSize = frame.size();
+    m_lastDelivery.start();
+    m_callback(frame, damage, timestamp);
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,70 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef COMPOSITOR_FRAME_CAPTURE_H
+#define COMPOSITOR_FRAME_CAPTURE_H
+
+#include "compositor.h"
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QRegion>
+#include <QTimer>
+
+#include <functional>
+#include <optional>
+
+namespace QtWebEngineCore {
+
+// Delivers the frames of a compositor to the thread the capture lives in.
+//
+// Frames are copied out of the compositor's buffers into one owned by the
+// capture, damage only, so frames kept by the receiver never pin a buffer
+// of the compositor. At most one delivery is pending at any time. Frames produced while a
+// delivery is pending or while the maximum frame rate would be exceeded
+// replace the pending frame and add their damage to it.
+class CompositorFrameCapture : public QObject, public Compositor::FrameSink
+{
+public:
+    // Frame, damage since the previously delivered frame and timestamp in
+    // microseconds of a monotonic clock.
+    using Callback = std::function<void(const QImage &, const QRegion &, qint64)>;
+
+    CompositorFrameCapture(Callback callback);
+    ~CompositorFrameCapture();
+
+    void setMaximumFrameRate(qreal maximumFrameRate);
+
+    // Follows the compositor with the given id, replacing the previous one.
+    void attach(Compositor::Id id);
+    void detach();
+
+    // Overridden from Compositor::FrameSink.
+    void frameProduced(const QImage &frame, const QRegion &damage) override;
+
+private:
+    void scheduleDelivery();
+    void deliver();
+
+    Callback m_callback;
+    std::optional<Compositor::Id> m_id;
+    qreal m_maximumFrameRate = 0;
+    QElapsedTimer m_lastDelivery;
+    QTimer m_rateTimer;
+    QSize m_lastDeliveredSize;
+
+    QMutex m_mutex;
+    // Latest produced frame. Delivered frames share it until the next
+    // frame detaches it.
+    QImage m_buffer;
+    bool m_framePending = false;
+    QRegion m_pendingDamage;
+    qint64 m_pendingTimestamp = 0;
+    bool m_deliveryScheduled = false;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // !COMPOSITOR_FRAME_CAPTURE_H
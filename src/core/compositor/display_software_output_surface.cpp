@@ -10,12 +10,135 @@
 #include "components/viz/service/display/display.h"
 #include "components/viz/service/display/output_surface_frame.h"
 
+#include <algorithm>
+#include <array>
+
 #include <QMutex>
-#include <QPainter>
+#include <QPointer>
 #include <QQuickWindow>
+#include <QRegion>
+#include <QSGTexture>
+#include <QtGui/private/qrhi_p.h>
 
 namespace QtWebEngineCore {
 
+// Frames larger than the maximum texture size of the RHI in either dimension
+// are split into tiles of kTileSize.
+static constexpr int kTileSize = 1024;
+// Granularity in which raster buffers of frames larger than a tile grow, so
+// that resizing does not reallocate them every time.
+static constexpr int kBufferGranularity = 256;
+
+static int maximumTextureSize(QQuickWindow *win)
+{
+    return win->rhi()->resourceLimit(QRhi::TextureSizeMax);
+}
+
+static bool isTiled(const QSize &size, int maximumTextureSize)
+{
+    return size.width() > maximumTextureSize || size.height() > maximumTextureSize;
+}
+
+// Size of the raster buffers backing frames of the given size.
+static QSize bufferSize(const QSize &size)
+{
+    if (size.width() <= kTileSize && size.height() <= kTileSize)
+        return size;
+    const auto roundUp = [](int value) {
+        return (value + kBufferGranularity - 1) / kBufferGranularity * kBufferGranularity;
+    };
+    return QSize(roundUp(size.width()), roundUp(size.height()));
+}
+
+// Texture that stays alive across frames and uploads only the damaged
+// parts of the frame image when the scene graph commits it.
+//
+// Covers rect of the frame image, which is the whole image unless the
+// frame is tiled.
+class DamageTrackingTexture final : public QSGTexture
+{
+public:
+    DamageTrackingTexture(const QRect &rect, bool hasAlpha)
+        : m_rect(rect), m_size(rect.size()), m_hasAlpha(hasAlpha) { }
+
+    QRect rect() const { return m_rect; }
+
+    // Schedules the given regions of image for upload on next commit.
+    void update(const QImage &image, const QRegion &damage)
+    {
+        m_image = image;
+        m_dirty += damage & m_rect;
+    }
+
+    // Overridden from QSGTexture.
+    qint64 comparisonKey() const override { return qint64(qintptr(this)); }
+    QRhiTexture *rhiTexture() const override { return m_texture.get(); }
+    QSize textureSize() const override { return m_size; }
+    bool hasAlphaChannel() const override { return m_hasAlpha; }
+    bool hasMipmaps() const override { return false; }
+    void commitTextureOperations(QRhi *rhi, QRhiResourceUpdateBatch *resourceUpdates) override;
+
+private:
+    QRect m_rect;
+    QSize m_size;
+    bool m_hasAlpha;
+    bool m_convert = false;
+    std::unique_ptr<QRhiTexture> m_texture;
+    QImage m_image;
+    QRegion m_dirty;
+};
+
+void DamageTrackingTexture::commitTextureOperations(QRhi *rhi,
+                                                    QRhiResourceUpdateBatch *resourceUpdates)
+{
+    if (!m_texture) {
+        QRhiTexture::Format format = QRhiTexture::RGBA8;
+        if (m_image.format() != QImage::Format_RGBA8888_Premultiplied) {
+            if (rhi->isTextureFormatSupported(QRhiTexture::BGRA8))
+                format = QRhiTexture::BGRA8;
+            else
+                m_convert = true;
+        }
+        m_texture.reset(rhi->newTexture(format, m_size));
+        if (!m_texture->create()) {
+            qWarning("Failed to create compositor texture of size %dx%d", m_size.width(),
+                     m_size.height());
+            m_texture.reset();
+            return;
+        }
+        m_dirty = m_rect;
+    }
+
+    if (m_image.isNull())
+        return;
+
+    QVarLengthArray<QRhiTextureUploadEntry, 8> entries;
+    for (const QRect &rect : m_dirty & m_rect & m_image.rect()) {
+        const QPoint destination = rect.topLeft() - m_rect.topLeft();
+        if (m_convert) {
+            QRhiTextureSubresourceUploadDescription desc(
+                    m_image.copy(rect).convertToFormat(QImage::Format_RGBA8888_Premultiplied));
+            desc.setDestinationTopLeft(destination);
+            entries.append(QRhiTextureUploadEntry(0, 0, desc));
+        } else {
+            QRhiTextureSubresourceUploadDescription desc(m_image);
+            desc.setSourceTopLeft(rect.topLeft());
+            desc.setSourceSize(rect.size());
+            desc.setDestinationTopLeft(destination);
+            entries.append(QRhiTextureUploadEntry(0, 0, desc));
+        }
+    }
+    if (!entries.isEmpty()) {
+        QRhiTextureUploadDescription desc;
+        desc.setEntries(entries.cbegin(), entries.cend());
+        resourceUpdates->uploadTexture(m_texture.get(), desc);
+    }
+
+    // Drop the reference so viz can paint into the frame buffer again.
+    m_image = QImage();
+    m_dirty = QRegion();
+}
+
 class DisplaySoftwareOutputSurface::Device final : public viz::SoftwareOutputDevice,
                                                    public Compositor
 {
@@ -25,26 +148,84 @@ public:
 
     // Overridden from viz::SoftwareOutputDevice.
     void Resize(const gfx::Size &sizeInPixels, float devicePixelRatio) override;
+    SkCanvas *BeginPaint(const gfx::Rect &damageRect) override;
     void OnSwapBuffers(SwapBuffersCallback swap_ack_callback, gfx::FrameData data) override;
 
     // Overridden from Compositor.
     void swapFrame() override;
-    QSGTexture *texture(QQuickWindow *win, uint32_t) override;
+    QSGTexture *texture(QQuickWindow *win, uint32_t textureOptions) override;
     bool textureIsFlipped() override;
+    bool textureIsPersistent(QQuickWindow *win) override;
+    QList<TextureTile> textureTiles(QQuickWindow *win, uint32_t textureOptions) override;
+    QImage image(QRegion *damage) override;
     float devicePixelRatio() override;
     QSize size() override;
     bool requiresAlphaChannel() override;
 
 private:
-    mutable QMutex m_mutex;
+    // Raster buffer painted by viz and handed to Qt without copying.
+    //
+    // Qt reads the pixels through QImages that hold a reference to the
+    // surface, so a buffer is free for painting only while the surface
+    // is uniquely owned by the device.
+    struct Buffer
+    {
+        sk_sp<SkSurface> surface;
+        // Parts of the frame painted into other buffers since this one was last painted.
+        QRegion staleRegion;
+    };
+    static constexpr int kBufferCount = 3;
+
+    // Only accessed on the viz thread.
+    std::array<Buffer, kBufferCount> m_buffers;
+    int m_backBuffer = -1;
+    int m_latestBuffer = -1;
     float m_devicePixelRatio = 1.0;
-    bool m_requiresAlpha;
+
+    // Guarded by m_mutex.
+    mutable QMutex m_mutex;
     scoped_refptr<base::SingleThreadTaskRunner> m_taskRunner;
     SwapBuffersCallback m_swapCompletionCallback;
+    QImage m_readyImage;
+    QRegion m_readyDamage;
+    float m_readyDevicePixelRatio = 1.0;
+
+    // Only accessed on the render thread.
+    bool m_requiresAlpha;
     QImage m_image;
     float m_imageDevicePixelRatio = 1.0;
+    QRegion m_imageDamage;
+    // Owned by the scene graph nodes.
+    QPointer<DamageTrackingTexture> m_texture;
+    QList<QPointer<DamageTrackingTexture>> m_tiles;
+    QSize m_tileGrid;
 };
 
+inline QImage::Format imageFormat(SkColorType colorType)
+{
+    switch (colorType) {
+    case kBGRA_8888_SkColorType:
+        return QImage::Format_ARGB32_Premultiplied;
+    case kRGBA_8888_SkColorType:
+        return QImage::Format_RGBA8888_Premultiplied;
+    default:
+        Q_UNREACHABLE_RETURN(QImage::Format_ARGB32_Premultiplied);
+    }
+}
+
+// Wraps the top left part of size of the pixels of surface in a read-only
+// QImage that keeps the surface alive.
+static QImage wrapSurface(sk_sp<SkSurface> surface, const QSize &size)
+{
+    SkPixmap skPixmap;
+    surface->peekPixels(&skPixmap);
+    auto *ref = new sk_sp<SkSurface>(std::move(surface));
+    return QImage(
+            reinterpret_cast<const uchar *>(skPixmap.addr()), size.width(), size.height(),
+            skPixmap.rowBytes(), imageFormat(skPixmap.colorType()),
+            [](void *info) { delete static_cast<sk_sp<SkSurface> *>(info); }, ref);
+}
+
 DisplaySoftwareOutputSurface::Device::Device(bool requiresAlpha)
     : Compositor(Type::Software)
     , m_requiresAlpha(requiresAlpha)
@@ -62,33 +243,107 @@ void DisplaySoftwareOutputSurface::Device::Resize(const gfx::Size &sizeInPixels,
         return;
     m_devicePixelRatio = devicePixelRatio;
     viewport_pixel_size_ = sizeInPixels;
-    surface_ = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(sizeInPixels.width(), sizeInPixels.height()));
+    // Buffers of the right size are kept, with all of their contents out of
+    // date. Buffers still referenced by the Qt side stay alive until released there.
+    surface_.reset();
+    const QSize size = toQt(sizeInPixels);
+    const QSize capacity = bufferSize(size);
+    for (Buffer &buffer : m_buffers) {
+        if (buffer.surface
+            && (buffer.surface->width() != capacity.width()
+                || buffer.surface->height() != capacity.height()))
+            buffer.surface.reset();
+        buffer.staleRegion = QRect(QPoint(), size);
+    }
+    m_backBuffer = -1;
+    m_latestBuffer = -1;
+}
+
+SkCanvas *DisplaySoftwareOutputSurface::Device::BeginPaint(const gfx::Rect &damageRect)
+{
+    damage_rect_ = damageRect;
+    surface_.reset();
+
+    // Pick a buffer that is neither the latest frame nor in use by Qt,
+    // allocating or replacing one if all of them are busy.
+    m_backBuffer = -1;
+    int emptyBuffer = -1;
+    for (int i = 0; i < kBufferCount; ++i) {
+        if (i == m_latestBuffer)
+            continue;
+        if (!m_buffers[i].surface) {
+            if (emptyBuffer < 0)
+                emptyBuffer = i;
+        } else if (m_buffers[i].surface->unique()) {
+            m_backBuffer = i;
+            break;
+        }
+    }
+    if (m_backBuffer < 0) {
+        m_backBuffer = emptyBuffer >= 0 ? emptyBuffer : (m_latestBuffer + 1) % kBufferCount;
+        Buffer &buffer = m_buffers[m_backBuffer];
+        const QSize capacity = bufferSize(toQt(viewport_pixel_size_));
+        buffer.surface = SkSurfaces::Raster(
+                SkImageInfo::MakeN32Premul(capacity.width(), capacity.height()));
+        buffer.staleRegion = QRect(QPoint(), toQt(viewport_pixel_size_));
+    }
+
+    // viz only repaints the damage, so bring the rest of the buffer up to
+    // date with the latest frame.
+    Buffer &back = m_buffers[m_backBuffer];
+    const QRegion copyRegion = back.staleRegion - toQt(damageRect);
+    if (m_latestBuffer >= 0 && !copyRegion.isEmpty()) {
+        SkPixmap latest;
+        m_buffers[m_latestBuffer].surface->peekPixels(&latest);
+        for (const QRect &rect : copyRegion) {
+            SkPixmap subset;
+            if (latest.extractSubset(&subset,
+                                     SkIRect::MakeXYWH(rect.x(), rect.y(), rect.width(), rect.height())))
+                back.surface->writePixels(subset, rect.x(), rect.y());
+        }
+    }
+    back.staleRegion = QRegion();
+
+    surface_ = back.surface;
+    return surface_->getCanvas();
 }
 
 void DisplaySoftwareOutputSurface::Device::OnSwapBuffers(SwapBuffersCallback swap_ack_callback, gfx::FrameData data)
 {
+    QImage image;
+    const QRect damageRect = toQt(damage_rect_);
+    if (m_backBuffer >= 0) {
+        for (int i = 0; i < kBufferCount; ++i) {
+            if (i != m_backBuffer && m_buffers[i].surface)
+                m_buffers[i].staleRegion += damageRect;
+        }
+        m_latestBuffer = m_backBuffer;
+        m_backBuffer = -1;
+        image = wrapSurface(m_buffers[m_latestBuffer].surface, toQt(viewport_pixel_size_));
+    }
+
     { // MEMO don't hold a lock together with an 'observer', as the call from Qt's scene graph may come at the same time
         QMutexLocker locker(&m_mutex);
         m_taskRunner = base::SingleThreadTaskRunner::GetCurrentDefault();
         m_swapCompletionCallback = std::move(swap_ack_callback);
+        if (!image.isNull()) {
+            // A frame not yet picked up by swapFrame() is dropped, its damage carries over.
+            m_readyImage = image;
+            m_readyDamage += damageRect;
+            m_readyDevicePixelRatio = m_devicePixelRatio;
+        }
+    }
+    recordFrameProduced(quint64(damageRect.width()) * damageRect.height());
+
+    if (!image.isNull()) {
+        if (auto sink = frameSink())
+            sink->frameProduced(image, damageRect);
     }
 
     if (auto obs = observer())
         obs->readyToSwap();
 }
 
-inline QImage::Format imageFormat(SkColorType colorType)
-{
-    switch (colorType) {
-    case kBGRA_8888_SkColorType:
-        return QImage::Format_ARGB32_Premultiplied;
-    case kRGBA_8888_SkColorType:
-        return QImage::Format_RGBA8888_Premultiplied;
-    default:
-        Q_UNREACHABLE_RETURN(QImage::Format_ARGB32_Premultiplied);
-    }
-}
-
 void DisplaySoftwareOutputSurface::Device::swapFrame()
 {
     QMutexLocker locker(&m_mutex);
@@ -96,29 +351,74 @@ void DisplaySoftwareOutputSurface::Device::swapFrame()
     if (!m_swapCompletionCallback)
         return;
 
-    SkPixmap skPixmap;
-    surface_->peekPixels(&skPixmap);
-    QImage image(reinterpret_cast<const uchar *>(skPixmap.addr()), viewport_pixel_size_.width(),
-                 viewport_pixel_size_.height(), skPixmap.rowBytes(),
-                 imageFormat(skPixmap.colorType()));
-    if (m_image.size() == image.size()) {
-        QRect damageRect = toQt(damage_rect_);
-        QPainter painter(&m_image);
-        painter.setCompositionMode(QPainter::CompositionMode_Source);
-        painter.drawImage(damageRect, image, damageRect);
-    } else {
-        m_image = image;
-        m_image.detach();
+    if (!m_readyImage.isNull()) {
+        if (m_readyImage.size() == m_image.size())
+            m_imageDamage += m_readyDamage;
+        else
+            m_imageDamage = QRect(QPoint(), m_readyImage.size());
+        m_image = std::move(m_readyImage);
+        m_readyImage = QImage();
+        m_readyDamage = QRegion();
+        m_imageDevicePixelRatio = m_readyDevicePixelRatio;
+        recordFramePresented();
     }
-    m_imageDevicePixelRatio = m_devicePixelRatio;
     m_taskRunner->PostTask(
             FROM_HERE, base::BindOnce(std::move(m_swapCompletionCallback), toGfx(m_image.size())));
     m_taskRunner.reset();
 }
 
-QSGTexture *DisplaySoftwareOutputSurface::Device::texture(QQuickWindow *win, uint32_t)
+QSGTexture *DisplaySoftwareOutputSurface::Device::texture(QQuickWindow *win, uint32_t textureOptions)
 {
-    return win->createTextureFromImage(m_image);
+    if (!textureIsPersistent(win))
+        return win->createTextureFromImage(m_image);
+
+    const bool hasAlpha = textureOptions & QQuickWindow::TextureHasAlphaChannel;
+    if (!m_texture || m_texture->textureSize() != m_image.size()
+        || m_texture->hasAlphaChannel() != hasAlpha) {
+        m_texture = new DamageTrackingTexture(m_image.rect(), hasAlpha);
+        m_imageDamage = QRect(QPoint(), m_image.size());
+    }
+    m_texture->update(m_image, m_imageDamage);
+    m_imageDamage = QRegion();
+    return m_texture;
+}
+
+QList<Compositor::TextureTile>
+DisplaySoftwareOutputSurface::Device::textureTiles(QQuickWindow *win, uint32_t textureOptions)
+{
+    if (!textureIsPersistent(win))
+        return {};
+    const int maximumSize = maximumTextureSize(win);
+    if (!isTiled(m_image.size(), maximumSize))
+        return {};
+
+    // Tiles are matched to scene graph nodes by position, so a different grid
+    // starts over with new textures.
+    const int tileSize = std::min(kTileSize, maximumSize);
+    const QSize grid((m_image.width() + tileSize - 1) / tileSize,
+                     (m_image.height() + tileSize - 1) / tileSize);
+    if (grid != m_tileGrid) {
+        m_tiles.clear();
+        m_tiles.resize(grid.width() * grid.height());
+        m_tileGrid = grid;
+    }
+
+    const bool hasAlpha = textureOptions & QQuickWindow::TextureHasAlphaChannel;
+    QList<TextureTile> tiles;
+    tiles.reserve(m_tiles.size());
+    for (int row = 0; row < grid.height(); ++row) {
+        for (int column = 0; column < grid.width(); ++column) {
+            const QRect rect = QRect(column * tileSize, row * tileSize, tileSize, tileSize)
+                    & m_image.rect();
+            QPointer<DamageTrackingTexture> &tile = m_tiles[row * grid.width() + column];
+            if (!tile || tile->rect() != rect || tile->hasAlphaChannel() != hasAlpha)
+                tile = new DamageTrackingTexture(rect, hasAlpha);
+            tile->update(m_image, m_imageDamage);
+            tiles.append({ rect, tile });
+        }
+    }
+    m_imageDamage = QRegion();
+    return tiles;
 }
 
 bool DisplaySoftwareOutputSurface::Device::textureIsFlipped()
@@ -126,6 +426,22 @@ bool DisplaySoftwareOutputSurface::Device::textureIsFlipped()
     return false;
 }
 
+// Without RHI (e.g. the software Qt Quick backend) textures are plain pixmaps
+// which cannot be partially updated.
+bool DisplaySoftwareOutputSurface::Device::textureIsPersistent(QQuickWindow *win)
+{
+    return win->rhi() != nullptr;
+}
+
+QImage DisplaySoftwareOutputSurface::Device::image(QRegion *damage)
+{
+    if (damage) {
+        *damage = m_imageDamage;
+        m_imageDamage = QRegion();
+    }
+    return m_image;
+}
+
 float DisplaySoftwareOutputSurface::Device::devicePixelRatio()
 {
     return m_imageDevicePixelRatio;
@@ -99,6 +99,11 @@ void NativeSkiaOutputDevice::Present(const std::optional<gfx::Rect> &update_rect
         m_readyToUpdate = true;
     }
 
+    const gfx::Size damageSize = update_rect ? update_rect->size()
+                                             : gfx::Size(m_shape.imageInfo.width(),
+                                                         m_shape.imageInfo.height());
+    recordFrameProduced(quint64(damageSize.width()) * damageSize.height());
+
     if (auto obs = observer())
         obs->readyToSwap();
 }
@@ -143,6 +148,7 @@ void NativeSkiaOutputDevice::swapFrame()
                                   base::BindOnce(&NativeSkiaOutputDevice::SwapBuffersFinished,
                                                  base::Unretained(this)));
         m_readyToUpdate = false;
+        recordFramePresented();
         if (m_frontBuffer) {
             m_readyWithTexture = true;
             m_frontBuffer->beginPresent();
@@ -56,7 +56,9 @@ void ContentSettingsManagerQt::AllowStorageAccess(const blink::LocalFrameToken &
     Q_UNUSED(storage_type);
     Q_UNUSED(site_for_cookies);
 
-    bool allowed = m_profile_io_data->canGetCookies(toQt(top_frame_origin), toQt(origin));
+    // Serialized, so that opaque origins keep counting as third party.
+    bool allowed = m_profile_io_data->canGetCookies(GURL(top_frame_origin.Serialize()),
+                                                    GURL(origin.Serialize()));
     std::move(callback).Run(allowed);
 }
 
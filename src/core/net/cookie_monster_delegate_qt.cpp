@@ -9,6 +9,7 @@
 
 #include "api/qwebenginecookiestore.h"
 #include "api/qwebenginecookiestore_p.h"
+#include "cookie_policy_qt.h"
 #include "type_conversion.h"
 
 #include <QNetworkCookie>
@@ -39,7 +40,7 @@ public:
 
     void AllowedAccess(const GURL &url, const net::SiteForCookies &site_for_cookies, AllowedAccessCallback callback) override
     {
-        bool allow = m_delegate->canGetCookies(toQt(site_for_cookies.first_party_url()), toQt(url));
+        bool allow = m_delegate->canAccessCookies(site_for_cookies.first_party_url(), url);
         std::move(callback).Run(allow);
     }
 
@@ -153,8 +154,7 @@ void CookieMonsterDelegateQt::setMojoCookieManager(mojo::PendingRemote<network::
     m_mojoCookieManager.Bind(std::move(cookie_manager_info));
 
     m_mojoCookieManager->AddGlobalChangeListener(m_receiver.BindNewPipeAndPassRemote());
-    if (m_hasFilter)
-        m_mojoCookieManager->SetRemoteFilter(m_filterReceiver.BindNewPipeAndPassRemote());
+    updateRemoteFilter();
 
     if (m_client)
         m_client->d_func()->processPendingUserCookies();
@@ -163,9 +163,30 @@ void CookieMonsterDelegateQt::setMojoCookieManager(mojo::PendingRemote<network::
 void CookieMonsterDelegateQt::setHasFilter(bool hasFilter)
 {
     m_hasFilter = hasFilter;
+    updateRemoteFilter();
+}
+
+void CookieMonsterDelegateQt::setCookiePolicy(std::shared_ptr<const CookiePolicyQt> policy)
+{
+    {
+        QMutexLocker locker(&m_policyMutex);
+        m_policy = std::move(policy);
+    }
+    updateRemoteFilter();
+}
+
+// The network service only asks about cookie access while a remote filter is
+// set, so one is needed for the callback as well as for the policy.
+void CookieMonsterDelegateQt::updateRemoteFilter()
+{
     if (!m_mojoCookieManager.is_bound())
         return;
-    if (m_hasFilter) {
+    bool needsFilter = m_hasFilter;
+    {
+        QMutexLocker locker(&m_policyMutex);
+        needsFilter = needsFilter || m_policy;
+    }
+    if (needsFilter) {
         if (!m_filterReceiver.is_bound())
             m_mojoCookieManager->SetRemoteFilter(m_filterReceiver.BindNewPipeAndPassRemote());
     } else {
@@ -196,18 +217,35 @@ void CookieMonsterDelegateQt::setClient(QWebEngineCookieStore *client)
 
 bool CookieMonsterDelegateQt::canSetCookie(const QUrl &firstPartyUrl, const QByteArray &/*cookieLine*/, const QUrl &url) const
 {
-    if (!m_client)
-        return true;
-
-    return m_client->d_func()->canAccessCookies(firstPartyUrl, url);
+    return canAccessCookies(toGurl(firstPartyUrl), toGurl(url));
 }
 
 bool CookieMonsterDelegateQt::canGetCookies(const QUrl &firstPartyUrl, const QUrl &url) const
 {
+    return canAccessCookies(toGurl(firstPartyUrl), toGurl(url));
+}
+
+bool CookieMonsterDelegateQt::canAccessCookies(const GURL &firstPartyUrl, const GURL &url) const
+{
+    std::shared_ptr<const CookiePolicyQt> policy;
+    {
+        QMutexLocker locker(&m_policyMutex);
+        policy = m_policy;
+    }
+
+    if (!policy) {
+        if (!m_client)
+            return true;
+        return m_client->d_func()->canAccessCookies(toQt(firstPartyUrl), toQt(url));
+    }
+
+    // Only what the policy leaves open reaches the cookie filter of the application.
+    const CookiePolicyQt::Result result = policy->evaluate(firstPartyUrl, url);
+    if (result.decision != CookiePolicyQt::Decision::Undecided)
+        return result.decision == CookiePolicyQt::Decision::Allow;
     if (!m_client)
         return true;
-
-    return m_client->d_func()->canAccessCookies(firstPartyUrl, url);
+    return m_client->d_func()->canAccessCookies(toQt(firstPartyUrl), toQt(url), result.thirdParty);
 }
 
 void CookieMonsterDelegateQt::OnCookieChanged(const net::CookieChangeInfo &change)
@@ -33,14 +33,18 @@
 #undef StAsH_signals
 #endif
 
+#include <QMutex>
 #include <QPointer>
 
+#include <memory>
+
 QT_FORWARD_DECLARE_CLASS(QNetworkCookie)
 QT_FORWARD_DECLARE_CLASS(QWebEngineCookieStore)
 
 namespace QtWebEngineCore {
 
 class CookieMonsterDelegateQtPrivate;
+class CookiePolicyQt;
 
 class Q_WEBENGINECORE_EXPORT CookieMonsterDelegateQt : public base::RefCountedThreadSafe<CookieMonsterDelegateQt>
 {
@@ -53,6 +57,10 @@ class Q_WEBENGINECORE_EXPORT CookieMonsterDelegateQt : public base::RefCountedTh
     mojo::Receiver<network::mojom::CookieChangeListener> m_receiver;
     mojo::Receiver<network::mojom::CookieRemoteAccessFilter> m_filterReceiver;
     bool m_hasFilter;
+    std::shared_ptr<const CookiePolicyQt> m_policy;
+    mutable QMutex m_policyMutex;
+
+    void updateRemoteFilter();
 public:
     CookieMonsterDelegateQt();
     ~CookieMonsterDelegateQt();
@@ -69,9 +77,11 @@ public:
     void setMojoCookieManager(mojo::PendingRemote<network::mojom::CookieManager> cookie_manager_info);
     void unsetMojoCookieManager();
     void setHasFilter(bool b);
+    void setCookiePolicy(std::shared_ptr<const CookiePolicyQt> policy);
 
     bool canSetCookie(const QUrl &firstPartyUrl, const QByteArray &cookieLine, const QUrl &url) const;
     bool canGetCookies(const QUrl &firstPartyUrl, const QUrl &url) const;
+    bool canAccessCookies(const GURL &firstPartyUrl, const GURL &url) const;
 
     void AddStore(net::CookieStore *store);
     void OnCookieChanged(const net::CookieChangeInfo &change);
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "cookie_policy_qt.h"
+
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "url/gurl.h"
+
+#include <QUrl>
+
+namespace QtWebEngineCore {
+
+// Pages load from a bounded set of hosts, so the cache is simply dropped
+// when it gets this large rather than tracking recency.
+static constexpr size_t kMaxCachedDecisions = 1024;
+
+static std::vector<std::string> toDomains(const QStringList &domains)
+{
+    std::vector<std::string> result;
+    result.reserve(domains.size());
+    for (const QString &domain : domains) {
+        QString normalized = domain.trimmed().toLower();
+        while (normalized.startsWith(u'.'))
+            normalized.remove(0, 1);
+        if (!normalized.isEmpty())
+            result.push_back(QUrl::toAce(normalized).toStdString());
+    }
+    return result;
+}
+
+// A domain also covers its subdomains.
+static bool matchesDomain(const std::vector<std::string> &domains, std::string_view host)
+{
+    for (const std::string &domain : domains) {
+        if (host.size() >= domain.size()
+            && host.substr(host.size() - domain.size()) == domain
+            && (host.size() == domain.size() || host[host.size() - domain.size() - 1] == '.'))
+            return true;
+    }
+    return false;
+}
+
+CookiePolicyQt::CookiePolicyQt(bool blockThirdParty, const QStringList &allowedDomains,
+                               const QStringList &blockedDomains)
+    : m_blockThirdParty(blockThirdParty)
+    , m_allowedDomains(toDomains(allowedDomains))
+    , m_blockedDomains(toDomains(blockedDomains))
+{
+}
+
+CookiePolicyQt::Result CookiePolicyQt::evaluate(const GURL &firstPartyUrl, const GURL &url) const
+{
+    // Hosts never contain '/', and an empty first-party URL, which means a
+    // first-party access, gets no separator at all.
+    std::string key;
+    if (!firstPartyUrl.is_empty()) {
+        key = firstPartyUrl.host();
+        key += '/';
+    }
+    key += url.host_piece();
+
+    {
+        QMutexLocker locker(&m_cacheMutex);
+        auto it = m_cache.find(key);
+        if (it != m_cache.end())
+            return it->second;
+    }
+
+    const Result result = decide(firstPartyUrl, url);
+
+    QMutexLocker locker(&m_cacheMutex);
+    if (m_cache.size() >= kMaxCachedDecisions)
+        m_cache.clear();
+    m_cache.emplace(std::move(key), result);
+    return result;
+}
+
+CookiePolicyQt::Result CookiePolicyQt::decide(const GURL &firstPartyUrl, const GURL &url) const
+{
+    // Empty first-party URL indicates a first-party request (see net/base/static_cookie_policy.cc)
+    const bool thirdParty = !firstPartyUrl.is_empty()
+            && !net::registry_controlled_domains::SameDomainOrHost(
+                    url, firstPartyUrl, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+
+    const std::string_view host = url.host_piece();
+    if (matchesDomain(m_blockedDomains, host))
+        return { Decision::Block, thirdParty };
+    if (matchesDomain(m_allowedDomains, host))
+        return { Decision::Allow, thirdParty };
+    if (thirdParty && m_blockThirdParty)
+        return { Decision::Block, thirdParty };
+    return { Decision::Undecided, thirdParty };
+}
+
+} // namespace QtWebEngineCore
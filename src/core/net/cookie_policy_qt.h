@@ -0,0 +1,59 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef COOKIE_POLICY_QT_H
+#define COOKIE_POLICY_QT_H
+
+#include <QtWebEngineCore/private/qtwebenginecoreglobal_p.h>
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qstringlist.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class GURL;
+
+namespace QtWebEngineCore {
+
+// Declarative cookie policy of a QWebEngineCookieStore, evaluated on GURLs
+// without calling into the application. Decisions only depend on the hosts
+// involved and are cached per pair of hosts. Immutable apart from the cache,
+// so changing the policy builds a new instance and starts with an empty cache.
+class Q_WEBENGINECORE_EXPORT CookiePolicyQt
+{
+public:
+    enum class Decision : quint8 { Allow, Block, Undecided };
+
+    struct Result
+    {
+        Decision decision;
+        bool thirdParty;
+    };
+
+    CookiePolicyQt(bool blockThirdParty, const QStringList &allowedDomains,
+                   const QStringList &blockedDomains);
+
+    bool isEmpty() const
+    {
+        return !m_blockThirdParty && m_allowedDomains.empty() && m_blockedDomains.empty();
+    }
+
+    Result evaluate(const GURL &firstPartyUrl, const GURL &url) const;
+
+private:
+    Result decide(const GURL &firstPartyUrl, const GURL &url) const;
+
+    bool m_blockThirdParty;
+    std::vector<std::string> m_allowedDomains;
+    std::vector<std::string> m_blockedDomains;
+
+    mutable QMutex m_cacheMutex;
+    mutable std::unordered_map<std::string, Result> m_cache;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // COOKIE_POLICY_QT_H
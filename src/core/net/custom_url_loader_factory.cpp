@@ -23,7 +23,10 @@
 #include "url/url_util_qt.h"
 
 #include "api/qwebengineurlscheme.h"
+#include "api/qwebengineurlschemehandler.h"
 #include "net/url_request_custom_job_proxy.h"
+#include "net/url_scheme_response_cache.h"
+#include "api/qwebengineurlschemehandler_p.h"
 #include "profile_adapter.h"
 #include "qwebengineloadinginfo.h"
 #include "type_conversion.h"
@@ -44,6 +47,9 @@ namespace QtWebEngineCore {
 
 namespace {
 
+// Largest data pipe allocated to hold an in-memory reply at once.
+constexpr int64_t kMaxDataPipeCapacity = 2 * 1024 * 1024;
+
 class CustomURLLoader : public network::mojom::URLLoader
                       , private URLRequestCustomJobProxy::Client
 {
@@ -52,11 +58,19 @@ public:
                                mojo::PendingReceiver<network::mojom::URLLoader> loader,
                                mojo::PendingRemote<network::mojom::URLLoaderClient> client_remote,
                                QPointer<ProfileAdapter> profileAdapter,
+                               std::shared_ptr<UrlSchemeHandlerAccess> threadPoolAccess,
+                               std::shared_ptr<UrlSchemeResponseCache> responseCache,
+                               bool prioritizedScheduling,
+                               bool streamingRequestBody,
                                content::WebContents *webContents)
     {
         // CustomURLLoader will handle its own life-cycle, and delete when
         // the client lets go.
-        auto *customUrlLoader = new CustomURLLoader(request, std::move(loader), std::move(client_remote), profileAdapter, webContents);
+        auto *customUrlLoader = new CustomURLLoader(request, std::move(loader), std::move(client_remote),
+                                                    profileAdapter, std::move(threadPoolAccess),
+                                                    std::move(responseCache),
+                                                    prioritizedScheduling, streamingRequestBody,
+                                                    webContents);
         customUrlLoader->Start();
     }
 
@@ -67,10 +81,11 @@ public:
                         const std::optional<GURL> &new_url) override
     {
         // We can be asked for follow our own redirect
-        scoped_refptr<URLRequestCustomJobProxy> proxy = new URLRequestCustomJobProxy(this, m_proxy->m_scheme, m_proxy->m_profileAdapter);
+        scoped_refptr<URLRequestCustomJobProxy> proxy =
+                new URLRequestCustomJobProxy(this, m_proxy->m_scheme, m_proxy->m_profileAdapter,
+                                             m_proxy->m_threadPoolAccess, HandlerTaskPriority());
         m_proxy->m_client = nullptr;
-//        m_taskRunner->PostTask(FROM_HERE, base::BindOnce(&URLRequestCustomJobProxy::release, m_proxy));
-        content::GetUIThreadTaskRunner({})->PostTask(FROM_HERE,
+        m_proxy->m_handlerTaskRunner->PostTask(FROM_HERE,
                        base::BindOnce(&URLRequestCustomJobProxy::release, m_proxy));
         m_proxy = std::move(proxy);
         if (new_url)
@@ -83,29 +98,57 @@ public:
         m_request.headers.MergeFrom(modified_headers);
         Start();
     }
-    void SetPriority(net::RequestPriority priority, int32_t intra_priority_value) override { }
-    void PauseReadingBodyFromNet() override { }
-    void ResumeReadingBodyFromNet() override { }
+    void SetPriority(net::RequestPriority priority, int32_t intra_priority_value) override
+    {
+        DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
+        Q_UNUSED(intra_priority_value);
+        m_request.priority = priority;
+        m_proxy->m_handlerTaskRunner->PostTask(
+                FROM_HERE, base::BindOnce(&URLRequestCustomJobProxy::setPriority, m_proxy, priority));
+    }
+    void PauseReadingBodyFromNet() override
+    {
+        DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
+        m_paused = true;
+    }
+    void ResumeReadingBodyFromNet() override
+    {
+        DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
+        if (!m_paused)
+            return;
+        m_paused = false;
+        if (m_watcher)
+            readAvailableData(); // May delete this
+    }
 
 private:
     CustomURLLoader(const network::ResourceRequest &request,
                     mojo::PendingReceiver<network::mojom::URLLoader> loader,
                     mojo::PendingRemote<network::mojom::URLLoaderClient> client_remote,
                     QPointer<ProfileAdapter> profileAdapter,
+                    std::shared_ptr<UrlSchemeHandlerAccess> threadPoolAccess,
+                    std::shared_ptr<UrlSchemeResponseCache> responseCache,
+                    bool prioritizedScheduling,
+                    bool streamingRequestBody,
                     content::WebContents *webContents)
         // ### We can opt to run the url-loader on the UI thread instead
         : m_taskRunner(content::GetIOThreadTaskRunner({}))
-        , m_proxy(new URLRequestCustomJobProxy(this, request.url.scheme(), profileAdapter))
+        , m_request(request)
+        , m_prioritizedScheduling(prioritizedScheduling)
+        , m_streamingRequestBody(streamingRequestBody)
+        , m_proxy(new URLRequestCustomJobProxy(this, request.url.scheme(), profileAdapter,
+                                               std::move(threadPoolAccess), HandlerTaskPriority()))
+        , m_responseCache(std::move(responseCache))
         , m_webContents(webContents)
         , m_receiver(this, std::move(loader))
         , m_client(std::move(client_remote))
-        , m_request(request)
     {
         DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
         m_receiver.set_disconnect_handler(
                     base::BindOnce(&CustomURLLoader::OnConnectionError, m_weakPtrFactory.GetWeakPtr()));
         m_firstBytePosition = 0;
         m_device = nullptr;
+        m_hasData = false;
         m_error = 0;
         QWebEngineUrlScheme scheme = QWebEngineUrlScheme::schemeByName(QByteArray::fromStdString(request.url.scheme()));
         m_corsEnabled = scheme.flags().testFlag(QWebEngineUrlScheme::CorsEnabled);
@@ -138,15 +181,9 @@ private:
             }
         }
 
-        if (mojo::CreateDataPipe(nullptr, m_pipeProducerHandle, m_pipeConsumerHandle) != MOJO_RESULT_OK)
-            return CompleteWithFailure(net::ERR_FAILED);
-
         m_head = network::mojom::URLResponseHead::New();
         m_head->request_start = base::TimeTicks::Now();
 
-        if (!m_pipeConsumerHandle.is_valid())
-            return CompleteWithFailure(net::ERR_FAILED);
-
         std::map<std::string, std::string> headers;
         net::HttpRequestHeaders::Iterator it(m_request.headers);
         while (it.GetNext())
@@ -158,12 +195,35 @@ private:
         if (ParseRange(m_request.headers))
             m_firstBytePosition = m_byteRange.first_byte_position();
 
-//        m_taskRunner->PostTask(FROM_HERE,
-        content::GetUIThreadTaskRunner({})->PostTask(
+        m_cacheEntry.reset();
+        m_notModified = false;
+        if (m_responseCache && m_request.method == net::HttpRequestHeaders::kGetMethod) {
+            if (auto entry = m_responseCache->lookup(CacheKey(), RequestHeaderLookup()))
+                return ReplyFromCache(std::move(*entry));
+        }
+
+        m_proxy->m_handlerTaskRunner->PostTask(
                 FROM_HERE,
                 base::BindOnce(&URLRequestCustomJobProxy::initialize, m_proxy, m_request.url,
                                m_request.method, m_request.request_initiator, std::move(headers),
-                               m_request.request_body));
+                               m_request.request_body, m_request.priority,
+                               m_streamingRequestBody));
+    }
+
+    // With prioritized scheduling, the handler is started from a task queue that
+    // matches the request priority, so that render-blocking stylesheets and
+    // scripts overtake pending images, and prefetches wait for an idle thread.
+    // The queue is picked when the proxy is created; priority changes from
+    // SetPriority() are forwarded to the job but do not move a pending start.
+    std::optional<base::TaskPriority> HandlerTaskPriority() const
+    {
+        if (!m_prioritizedScheduling)
+            return std::nullopt;
+        if (m_request.priority >= net::MEDIUM)
+            return base::TaskPriority::USER_BLOCKING;
+        if (m_request.priority >= net::LOWEST)
+            return base::TaskPriority::USER_VISIBLE;
+        return base::TaskPriority::BEST_EFFORT;
     }
 
     void CompleteWithFailure(network::CorsErrorStatus cors_error)
@@ -194,6 +254,8 @@ private:
     {
         DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
         if (result == MOJO_RESULT_OK) {
+            if (m_cacheEntry)
+                m_responseCache->insert(CacheKey(), std::move(*m_cacheEntry));
             network::URLLoaderCompletionStatus status(net::OK);
             status.encoded_data_length = m_totalBytesRead + m_headerBytesRead;
             status.encoded_body_length = m_totalBytesRead;
@@ -210,31 +272,96 @@ private:
         DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
         m_proxy->m_client = nullptr;
         m_client.reset();
+        m_data.clear();
+        if (m_mapping && m_device)
+            static_cast<QFile *>(m_device)->unmap(m_mapping);
+        m_mapping = nullptr;
         if (m_device && m_device->isOpen())
             m_device->close();
         m_device = nullptr;
-//        m_taskRunner->PostTask(FROM_HERE, base::BindOnce(&URLRequestCustomJobProxy::release, m_proxy));
-        content::GetUIThreadTaskRunner({})->PostTask(FROM_HERE,
+        m_proxy->m_handlerTaskRunner->PostTask(FROM_HERE,
                        base::BindOnce(&URLRequestCustomJobProxy::release, m_proxy));
         if (!wait_for_loader_error || !m_receiver.is_bound())
             delete this;
     }
 
     // URLRequestCustomJobProxy::Client:
-    void notifyExpectedContentSize(qint64 size) override
+    // Returns false if the requested range cannot be satisfied.
+    bool SetExpectedContentSize(qint64 size)
     {
-        DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
         m_totalSize = size;
         if (m_byteRange.IsValid()) {
-            if (!m_byteRange.ComputeBounds(size)) {
-                CompleteWithFailure(net::ERR_REQUEST_RANGE_NOT_SATISFIABLE);
-            } else {
-                m_maxBytesToRead = m_byteRange.last_byte_position() - m_byteRange.first_byte_position() + 1;
-                m_head->content_length = m_maxBytesToRead;
-            }
+            if (!m_byteRange.ComputeBounds(size))
+                return false;
+            m_maxBytesToRead = m_byteRange.last_byte_position() - m_byteRange.first_byte_position() + 1;
+            m_head->content_length = m_maxBytesToRead;
         } else {
             m_head->content_length = size;
         }
+        return true;
+    }
+
+    // Offset of the first byte to send once the size of the body is known.
+    int64_t BodyOffset() const
+    {
+        return m_byteRange.IsValid() && m_totalSize > 0 ? m_byteRange.first_byte_position() : 0;
+    }
+
+    QByteArray CacheKey() const
+    {
+        return QByteArray::fromStdString(m_request.url.spec());
+    }
+
+    UrlSchemeResponseCache::RequestHeaderLookup RequestHeaderLookup() const
+    {
+        return [this](const QByteArray &name) {
+            return QByteArray::fromStdString(
+                    m_request.headers.GetHeader(name.toStdString()).value_or(std::string()));
+        };
+    }
+
+    void ReplyFromCache(UrlSchemeResponseCache::Entry entry)
+    {
+        m_mimeType = std::move(entry.mimeType);
+        m_charset = std::move(entry.charset);
+        m_additionalResponseHeaders = std::move(entry.additionalResponseHeaders);
+        m_hasData = true;
+        m_notModified = UrlSchemeResponseCache::matchesIfNoneMatch(
+                entry, RequestHeaderLookup()("if-none-match"));
+        if (!m_notModified) {
+            m_data = std::move(entry.body);
+            if (!m_data.isEmpty() && !SetExpectedContentSize(m_data.size()))
+                return CompleteWithFailure(net::ERR_REQUEST_RANGE_NOT_SATISFIABLE);
+        }
+        notifyHeadersComplete();
+    }
+
+    // Prepares storing the response in the cache if it is a complete and
+    // cacheable response to a GET request.
+    void PrepareCacheEntry()
+    {
+        if (!m_responseCache || m_notModified || m_byteRange.IsValid()
+            || m_request.method != net::HttpRequestHeaders::kGetMethod)
+            return;
+        if (m_totalSize > m_responseCache->maximumEntrySize())
+            return;
+        m_cacheEntry = UrlSchemeResponseCache::cacheableEntry(m_additionalResponseHeaders,
+                                                              RequestHeaderLookup());
+        if (!m_cacheEntry)
+            return;
+        m_cacheEntry->mimeType = m_mimeType;
+        m_cacheEntry->charset = m_charset;
+        // In-memory replies are shared with the cache, other bodies are
+        // collected while they are written to the pipe.
+        if (m_hasData && !m_mapping)
+            m_cacheEntry->body = m_data;
+    }
+
+    void notifyExpectedContentSize(qint64 size) override
+    {
+        DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
+        if (!SetExpectedContentSize(size))
+            CompleteWithFailure(net::ERR_REQUEST_RANGE_NOT_SATISFIABLE);
     }
     void notifyHeadersComplete() override
     {
@@ -247,7 +374,7 @@ private:
             headers += "HTTP/1.1 303 See Other\n";
             headers += base::StringPrintf("Location: %s\n", m_redirect.spec().c_str());
         } else {
-            if (m_byteRange.IsValid() && m_totalSize > 0) {
+            if (m_byteRange.IsValid() && m_totalSize > 0 && !m_notModified) {
                 headers += "HTTP/1.1 206 Partial Content\n";
                 headers += net::HttpResponseHeaders::kContentRange;
                 headers += base::StringPrintf(": bytes %lld-%lld/%lld",
@@ -255,6 +382,8 @@ private:
                                               qlonglong{m_byteRange.last_byte_position()},
                                               qlonglong{m_totalSize});
                 headers += "\n";
+            } else if (m_notModified) {
+                headers += "HTTP/1.1 304 Not Modified\n";
             } else {
                 headers += "HTTP/1.1 200 OK\n";
             }
@@ -297,7 +426,14 @@ private:
             // ### should m_request be updated with RedirectInfo? (see FollowRedirect)
             return;
         }
-        DCHECK(m_device);
+        DCHECK(m_device || m_hasData);
+        if (m_hasData)
+            m_dataPosition = BodyOffset();
+        else
+            MapFile();
+        if (!CreateBodyPipe())
+            return CompleteWithFailure(net::ERR_FAILED);
+        PrepareCacheEntry();
         m_head->mime_type = m_mimeType;
         m_head->charset = m_charset;
         m_headerBytesRead = m_head->headers->raw_headers().length();
@@ -377,12 +513,54 @@ private:
         }
         readAvailableData();
     }
+    // Replies with a file are served from a mapping of the bytes to send, which
+    // turns byte ranges into offsets and replaces the seeks and QIODevice reads.
+    // Pages that are not resident yet are still read from disk on the IO thread,
+    // through page faults while copying into the data pipe.
+    void MapFile()
+    {
+        QFile *file = qobject_cast<QFile *>(m_device);
+        if (!file || m_totalSize <= 0)
+            return;
+        const int64_t length =
+                m_maxBytesToRead > 0 ? m_maxBytesToRead : m_totalSize - BodyOffset();
+        if (length <= 0 || length > std::numeric_limits<qsizetype>::max())
+            return;
+        uchar *mapping = file->map(BodyOffset(), length);
+        if (!mapping)
+            return;
+        m_mapping = mapping;
+        m_data = QByteArray::fromRawData(reinterpret_cast<const char *>(mapping), length);
+        m_dataPosition = 0;
+        m_hasData = true;
+    }
+    bool CreateBodyPipe()
+    {
+        // In-memory replies get a pipe that fits the whole body, up to a limit,
+        // so that they are written in one go.
+        int64_t remaining = m_data.size() - m_dataPosition;
+        if (m_maxBytesToRead > 0)
+            remaining = std::min(remaining, m_maxBytesToRead);
+        if (!m_hasData || remaining <= 0) {
+            return mojo::CreateDataPipe(nullptr, m_pipeProducerHandle, m_pipeConsumerHandle)
+                    == MOJO_RESULT_OK;
+        }
+        MojoCreateDataPipeOptions options;
+        options.struct_size = sizeof(MojoCreateDataPipeOptions);
+        options.flags = MOJO_CREATE_DATA_PIPE_FLAG_NONE;
+        options.element_num_bytes = 1;
+        options.capacity_num_bytes = uint32_t(std::min(remaining, kMaxDataPipeCapacity));
+        return mojo::CreateDataPipe(&options, m_pipeProducerHandle, m_pipeConsumerHandle)
+                == MOJO_RESULT_OK;
+    }
     bool readAvailableData()
     {
         DCHECK(m_taskRunner->RunsTasksInCurrentSequence());
         for (;;) {
-            if (m_error || !m_device)
+            if (m_error || (!m_device && !m_hasData))
                 break;
+            if (m_paused)
+                return false; // Wait for ResumeReadingBodyFromNet
 
             base::span<uint8_t> buffer;
             MojoResult beginResult =
@@ -395,17 +573,37 @@ private:
             if (beginResult != MOJO_RESULT_OK)
                 break;
             size_t bufferSize = buffer.size();
-            if (m_maxBytesToRead > 0 && m_maxBytesToRead <= int64_t{std::numeric_limits<uint32_t>::max()})
-                bufferSize = std::min(bufferSize, size_t(m_maxBytesToRead));
+            if (m_maxBytesToRead > 0) {
+                const int64_t bytesLeft = m_maxBytesToRead - m_totalBytesRead;
+                if (bytesLeft < int64_t(bufferSize))
+                    bufferSize = size_t(std::max(bytesLeft, int64_t(0)));
+            }
 
-            int readResult = m_device->read(reinterpret_cast<char *>(buffer.data()), bufferSize);
+            int readResult;
+            bool deviceAtEnd;
+            if (!m_hasData) {
+                readResult = m_device->read(reinterpret_cast<char *>(buffer.data()), bufferSize);
+                deviceAtEnd = m_device->atEnd();
+            } else {
+                readResult = int(std::clamp(m_data.size() - m_dataPosition, qint64(0),
+                                            qint64(bufferSize)));
+                memcpy(buffer.data(), m_data.constData() + m_dataPosition, readResult);
+                m_dataPosition += readResult;
+                deviceAtEnd = m_dataPosition >= m_data.size();
+            }
+            const bool sequential = !m_hasData && m_device->isSequential();
             uint32_t bytesRead = std::max(readResult, 0);
+            if (m_cacheEntry && (m_mapping || !m_hasData)) {
+                if (m_cacheEntry->body.size() + bytesRead > m_responseCache->maximumEntrySize())
+                    m_cacheEntry.reset();
+                else
+                    m_cacheEntry->body.append(reinterpret_cast<const char *>(buffer.data()), bytesRead);
+            }
             m_pipeProducerHandle->EndWriteData(bytesRead);
             m_totalBytesRead += bytesRead;
             m_client->OnTransferSizeUpdated(m_totalBytesRead);
 
-            const bool deviceAtEnd = m_device->atEnd();
-            if ((deviceAtEnd && !m_device->isSequential())
+            if ((deviceAtEnd && !sequential)
                 || (m_maxBytesToRead > 0 && m_totalBytesRead >= m_maxBytesToRead)) {
                 OnTransferComplete(MOJO_RESULT_OK);
                 return true; // Done with reading
@@ -413,7 +611,7 @@ private:
 
             if (readResult == 0)
                 return false; // Wait for readyRead
-            if (readResult < 0 && deviceAtEnd && m_device->isSequential()) {
+            if (readResult < 0 && deviceAtEnd && sequential) {
                 // Failure on read, and sequential device claiming to be at end, so treat it as a successful end-of-data.
                 OnTransferComplete(MOJO_RESULT_OK);
                 return true; // Done with reading
@@ -446,6 +644,9 @@ private:
     }
 
     scoped_refptr<base::SequencedTaskRunner> m_taskRunner;
+    network::ResourceRequest m_request;
+    bool m_prioritizedScheduling;
+    bool m_streamingRequestBody;
     scoped_refptr<URLRequestCustomJobProxy> m_proxy;
     content::WebContents *m_webContents;
 
@@ -458,10 +659,15 @@ private:
     net::HttpByteRange m_byteRange;
     int64_t m_totalSize = 0;
     int64_t m_maxBytesToRead = -1;
-    network::ResourceRequest m_request;
     network::mojom::URLResponseHeadPtr m_head;
     qint64 m_headerBytesRead = 0;
     qint64 m_totalBytesRead = 0;
+    qint64 m_dataPosition = 0;
+    uchar *m_mapping = nullptr;
+    std::shared_ptr<UrlSchemeResponseCache> m_responseCache;
+    std::optional<UrlSchemeResponseCache::Entry> m_cacheEntry;
+    bool m_notModified = false;
+    bool m_paused = false;
     bool m_corsEnabled;
     bool m_isLocal;
 
@@ -494,10 +700,32 @@ public:
         Q_UNUSED(options);
         Q_UNUSED(traffic_annotation);
 
+        std::shared_ptr<UrlSchemeHandlerAccess> threadPoolAccess;
+        std::shared_ptr<UrlSchemeResponseCache> responseCache;
+        bool prioritizedScheduling = false;
+        bool streamingRequestBody = false;
+        if (m_profileAdapter) {
+            QWebEngineUrlSchemeHandler *handler =
+                    m_profileAdapter->urlSchemeHandler(toQByteArray(request.url.scheme()));
+            if (handler) {
+                QWebEngineUrlSchemeHandlerPrivate *handlerPrivate =
+                        QWebEngineUrlSchemeHandlerPrivate::get(handler);
+                if (handler->threadingMode() == QWebEngineUrlSchemeHandler::ThreadingMode::ThreadPool)
+                    threadPoolAccess = handlerPrivate->threadPoolAccess();
+                responseCache = m_profileAdapter->urlSchemeResponseCache(
+                        toQByteArray(request.url.scheme()));
+                prioritizedScheduling = handlerPrivate->prioritizedScheduling;
+                streamingRequestBody = handlerPrivate->requestBodyStreaming;
+            }
+        }
+
         m_taskRunner->PostTask(FROM_HERE,
                                base::BindOnce(&CustomURLLoader::CreateAndStart, request,
                                               std::move(loader), std::move(client),
-                                              m_profileAdapter, m_webContents));
+                                              m_profileAdapter, std::move(threadPoolAccess),
+                                              std::move(responseCache),
+                                              prioritizedScheduling, streamingRequestBody,
+                                              m_webContents));
 
     }
 
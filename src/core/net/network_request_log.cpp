@@ -0,0 +1,39 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "network_request_log.h"
+
+namespace QtWebEngineCore {
+
+// A page load typically finishes dozens of requests within this time.
+static constexpr int kFlushDelayMs = 500;
+static constexpr qsizetype kMaximumBatchSize = 128;
+
+NetworkRequestLog::NetworkRequestLog(Callback callback) : m_callback(std::move(callback))
+{
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(kFlushDelayMs);
+    QObject::connect(&m_flushTimer, &QTimer::timeout, this, &NetworkRequestLog::flush);
+}
+
+NetworkRequestLog::~NetworkRequestLog() = default;
+
+void NetworkRequestLog::add(NetworkRequestEntry &&entry)
+{
+    m_pending.append(std::move(entry));
+    if (m_pending.size() >= kMaximumBatchSize)
+        flush();
+    else if (!m_flushTimer.isActive())
+        m_flushTimer.start();
+}
+
+void NetworkRequestLog::flush()
+{
+    m_flushTimer.stop();
+    if (m_pending.isEmpty())
+        return;
+    const QList<NetworkRequestEntry> batch = std::exchange(m_pending, {});
+    m_callback(batch);
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef NETWORK_REQUEST_LOG_H
+#define NETWORK_REQUEST_LOG_H
+
+#include <QList>
+#include <QTimer>
+#include <QUrl>
+
+#include <functional>
+
+namespace QtWebEngineCore {
+
+// What is known about a request of a page once it completed. Durations are in
+// microseconds, and -1 where the phase did not happen or was not measured.
+struct NetworkRequestEntry
+{
+    QUrl url;
+    QUrl initiator;
+    int resourceType = 0;
+    int statusCode = 0;
+    int error = 0;
+    bool fromCache = false;
+    qint64 dnsDuration = -1;
+    qint64 connectDuration = -1;
+    qint64 sslDuration = -1;
+    qint64 timeToFirstByte = -1;
+    qint64 downloadDuration = -1;
+    qint64 totalDuration = -1;
+    qint64 encodedDataLength = 0;
+    qint64 encodedBodyLength = 0;
+    qint64 decodedBodyLength = 0;
+};
+
+// Collects the finished requests of a page and hands them on in batches: when
+// enough have piled up, or a short while after the first of a batch, so that
+// a busy page costs one callback per batch and not one per request.
+class NetworkRequestLog : public QObject
+{
+public:
+    using Callback = std::function<void(const QList<NetworkRequestEntry> &)>;
+
+    NetworkRequestLog(Callback callback);
+    ~NetworkRequestLog();
+
+    void add(NetworkRequestEntry &&entry);
+    void flush();
+
+private:
+    Callback m_callback;
+    QList<NetworkRequestEntry> m_pending;
+    QTimer m_flushTimer;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // !NETWORK_REQUEST_LOG_H
@@ -7,10 +7,13 @@
 
 #include "base/functional/bind.h"
 #include "content/browser/web_contents/web_contents_impl.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/common/content_switches.h"
 #include "net/base/filename_util.h"
+#include "net/base/load_timing_info.h"
+#include "net/http/http_response_headers.h"
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/cors/cors.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -19,12 +22,19 @@
 #include "url/url_util.h"
 #include "url/url_util_qt.h"
 
+#include "api/qwebengineurlrequestdecision_p.h"
 #include "api/qwebengineurlrequestinfo_p.h"
+#include "api/qwebengineurlrequestinterceptor_p.h"
+#include "api/qwebengineurlresponseinfo_p.h"
+#include "api/qwebengineurlresponseinterceptor.h"
 #include "type_conversion.h"
 #include "web_contents_adapter.h"
 #include "web_contents_adapter_client.h"
 #include "web_contents_view_qt.h"
+#include "net/network_request_log.h"
 #include "net/resource_request_body_qt.h"
+#include "net/response_body_transformer_qt.h"
+#include "net/url_request_rule_matcher.h"
 
 // originally based on aw_proxying_url_loader_factory.cc:
 // Copyright 2018 The Chromium Authors. All rights reserved.
@@ -131,7 +141,13 @@ public:
 
 private:
     void InterceptOnUIThread();
+    bool ParkIfDeferred();
+    void ContinueAfterDeferredIntercept(QWebEngineUrlRequestDecisionPrivate::Decision decision);
     void ContinueAfterIntercept();
+    bool ApplyUrlRequestRules();
+    void InterceptResponse(network::mojom::URLResponseHeadPtr &head,
+                           mojo::ScopedDataPipeConsumerHandle &body);
+    void RedirectTo(const GURL &url);
 
     // This is called when the original URLLoaderClient has a connection error.
     void OnURLLoaderClientError();
@@ -149,6 +165,9 @@ private:
     content::WebContents* webContents();
     QWebEngineUrlRequestInterceptor* getProfileInterceptor();
     QWebEngineUrlRequestInterceptor* getPageInterceptor();
+    bool WantsRequest(const QWebEngineUrlRequestInterceptor *interceptor) const;
+    NetworkRequestLog *getNetworkRequestLog();
+    void RecordRequest(const network::URLLoaderCompletionStatus &status);
 
     QPointer<ProfileAdapter> profile_adapter_;
     const content::FrameTreeNodeId frame_tree_node_id_;
@@ -179,6 +198,10 @@ private:
 
     std::unique_ptr<QWebEngineUrlRequestInfo, RequestInfoDeleter> request_info_;
 
+    // The interceptors that still have to see request_info_, in order.
+    enum class InterceptStage { Profile, Page, Done };
+    InterceptStage intercept_stage_ = InterceptStage::Profile;
+
     mojo::Receiver<network::mojom::URLLoader> proxied_loader_receiver_;
     mojo::Remote<network::mojom::URLLoaderClient> target_client_;
     mojo::Receiver<network::mojom::URLLoaderClient> proxied_client_receiver_{this};
@@ -264,6 +287,24 @@ QWebEngineUrlRequestInterceptor* InterceptedRequest::getPageInterceptor()
     return nullptr;
 }
 
+NetworkRequestLog *InterceptedRequest::getNetworkRequestLog()
+{
+    if (auto wc = webContents()) {
+        auto view = static_cast<content::WebContentsImpl *>(wc)->GetView();
+        if (WebContentsAdapterClient *client = WebContentsViewQt::from(view)->client())
+            return client->webContentsAdapter()->networkRequestLog();
+    }
+    return nullptr;
+}
+
+// Whether |interceptor| is set and its filters let the request through.
+bool InterceptedRequest::WantsRequest(const QWebEngineUrlRequestInterceptor *interceptor) const
+{
+    return QWebEngineUrlRequestInterceptorPrivate::wantsRequest(
+            interceptor, request_.resource_type, request_.url.scheme_piece(),
+            request_.url.host_piece());
+}
+
 void InterceptedRequest::Restart()
 {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
@@ -287,11 +328,8 @@ void InterceptedRequest::Restart()
 
     // Check if non-local access is allowed
     if (!allow_remote_ && remote_access_) {
-        if (!granted_special_access) {
-            target_client_->OnComplete(network::URLLoaderCompletionStatus(net::ERR_NETWORK_ACCESS_DENIED));
-            delete this;
-            return;
-        }
+        if (!granted_special_access)
+            return SendErrorAndCompleteImmediately(net::ERR_NETWORK_ACCESS_DENIED);
     }
 
     // Check if local access is allowed
@@ -305,18 +343,17 @@ void InterceptedRequest::Restart()
                     granted_special_access = true;
             }
         }
-        if (!granted_special_access) {
-            target_client_->OnComplete(network::URLLoaderCompletionStatus(net::ERR_ACCESS_DENIED));
-            delete this;
-            return;
-        }
+        if (!granted_special_access)
+            return SendErrorAndCompleteImmediately(net::ERR_ACCESS_DENIED);
     }
 
+    if (ApplyUrlRequestRules())
+        return;
+
     // MEMO since all codepatch leading to Restart scheduled and executed as asynchronous tasks in main thread,
     //      interceptors may change in meantime and also during intercept call, so they should be resolved anew.
-    //      Set here only profile's interceptor since it runs first without going to user code.
-    auto profileInterceptor = getProfileInterceptor();
-    if (!profileInterceptor && !getPageInterceptor()) {
+    //      Interceptors whose filters skip this request don't need request_info_ built at all.
+    if (!WantsRequest(getProfileInterceptor()) && !WantsRequest(getPageInterceptor())) {
         ContinueAfterIntercept();
         return;
     }
@@ -342,23 +379,74 @@ void InterceptedRequest::Restart()
     auto info = new QWebEngineUrlRequestInfoPrivate(
             resourceType, navigationType, originalUrl, firstPartyUrl, initiator,
             QByteArray::fromStdString(request_.method), &request_body_, headers, isDownload);
+    info->deferrable = true;
     Q_ASSERT(!request_info_);
     request_info_.reset(new QWebEngineUrlRequestInfo(info));
 
+    intercept_stage_ = InterceptStage::Profile;
     InterceptOnUIThread();
-    ContinueAfterIntercept();
 }
 
+// Runs the interceptors that have not seen the request yet, and continues it
+// unless one of them deferred its decision.
 void InterceptedRequest::InterceptOnUIThread()
 {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-    if (auto interceptor = getProfileInterceptor())
-        interceptor->interceptRequest(*request_info_);
-
-    if (!request_info_->changed()) {
-        if (auto interceptor = getPageInterceptor())
+    if (intercept_stage_ == InterceptStage::Profile) {
+        intercept_stage_ = InterceptStage::Page;
+        auto interceptor = getProfileInterceptor();
+        if (WantsRequest(interceptor)) {
             interceptor->interceptRequest(*request_info_);
+            if (ParkIfDeferred())
+                return;
+        }
+    }
+
+    if (intercept_stage_ == InterceptStage::Page) {
+        intercept_stage_ = InterceptStage::Done;
+        if (!request_info_->changed()) {
+            auto interceptor = getPageInterceptor();
+            if (WantsRequest(interceptor)) {
+                interceptor->interceptRequest(*request_info_);
+                if (ParkIfDeferred())
+                    return;
+            }
+        }
     }
+
+    ContinueAfterIntercept();
+}
+
+// Keeps the request waiting if the interceptor deferred its decision. The
+// decision arrives from any thread and is handed back to the UI thread.
+bool InterceptedRequest::ParkIfDeferred()
+{
+    QExplicitlySharedDataPointer<QWebEngineUrlRequestDecisionPrivate> deferral =
+            std::move(request_info_->d_ptr->deferral);
+    if (!deferral)
+        return false;
+    deferral->setCallback(
+            [taskRunner = content::GetUIThreadTaskRunner({}),
+             weakThis = weak_factory_.GetWeakPtr()](QWebEngineUrlRequestDecisionPrivate::Decision decision) {
+                taskRunner->PostTask(
+                        FROM_HERE,
+                        base::BindOnce(&InterceptedRequest::ContinueAfterDeferredIntercept,
+                                       weakThis, std::move(decision)));
+            });
+    return true;
+}
+
+void InterceptedRequest::ContinueAfterDeferredIntercept(
+        QWebEngineUrlRequestDecisionPrivate::Decision decision)
+{
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    if (decision.block)
+        request_info_->block(*decision.block);
+    if (decision.redirectUrl)
+        request_info_->redirect(*decision.redirectUrl);
+    for (const auto &[name, value] : std::as_const(decision.headers))
+        request_info_->setHttpHeader(name, value);
+    InterceptOnUIThread();
 }
 
 void InterceptedRequest::ContinueAfterIntercept()
@@ -384,27 +472,7 @@ void InterceptedRequest::ContinueAfterIntercept()
                 return SendErrorAndCompleteImmediately(net::ERR_ACCESS_DENIED);
 
             if (info.shouldRedirectRequest) {
-                net::RedirectInfo::FirstPartyURLPolicy first_party_url_policy =
-                        request_.update_first_party_url_on_redirect ? net::RedirectInfo::FirstPartyURLPolicy::UPDATE_URL_ON_REDIRECT
-                                                                    : net::RedirectInfo::FirstPartyURLPolicy::NEVER_CHANGE_URL;
-                net::RedirectInfo redirectInfo = net::RedirectInfo::ComputeRedirectInfo(
-                        request_.method, request_.url, request_.site_for_cookies,
-                        first_party_url_policy, request_.referrer_policy, request_.referrer.spec(),
-                        net::HTTP_TEMPORARY_REDIRECT, toGurl(info.url), std::nullopt,
-                        false /*insecure_scheme_was_upgraded*/);
-                request_.method = redirectInfo.new_method;
-                request_.url = redirectInfo.new_url;
-                request_.site_for_cookies = redirectInfo.new_site_for_cookies;
-                request_.referrer = GURL(redirectInfo.new_referrer);
-                request_.referrer_policy = redirectInfo.new_referrer_policy;
-                if (request_.method == net::HttpRequestHeaders::kGetMethod)
-                    request_.request_body = nullptr;
-                // In case of multiple sequential rediredts, current_response_ has previously been moved to target_client_
-                // so we create a new one using the redirect url.
-                if (!current_response_)
-                    current_response_ = createResponse(request_);
-                current_response_->encoded_data_length = 0;
-                target_client_->OnReceiveRedirect(redirectInfo, std::move(current_response_));
+                RedirectTo(toGurl(info.url));
                 return;
             }
         }
@@ -412,21 +480,128 @@ void InterceptedRequest::ContinueAfterIntercept()
 
     if (!target_loader_ && target_factory_) {
         loader_error_seen_ = false;
+        // The network service only measures the phases of the request when asked to.
+        if (getNetworkRequestLog())
+            request_.enable_load_timing = true;
         target_factory_->CreateLoaderAndStart(target_loader_.BindNewPipeAndPassReceiver(), request_id_,
                                               options_, request_, proxied_client_receiver_.BindNewPipeAndPassRemote(),
                                               traffic_annotation_);
     }
 }
 
+// Evaluates the profile's URL request rules, and returns whether they already
+// completed or redirected the request.
+bool InterceptedRequest::ApplyUrlRequestRules()
+{
+    const std::shared_ptr<const UrlRequestRuleMatcher> matcher =
+            profile_adapter_ ? profile_adapter_->urlRequestRuleMatcher() : nullptr;
+    if (!matcher)
+        return false;
+
+    const auto resourceType = blink::mojom::ResourceType(request_.resource_type);
+    const bool thirdParty = resourceType != blink::mojom::ResourceType::kMainFrame
+            && !request_.site_for_cookies.IsFirstParty(request_.url);
+    const UrlRequestRuleMatcher::Result result = matcher->match(
+            { request_.url.possibly_invalid_spec(), int(resourceType), thirdParty });
+
+    if (result.block) {
+        SendErrorAndCompleteImmediately(net::ERR_BLOCKED_BY_CLIENT);
+        return true;
+    }
+    if (result.redirectUrl) {
+        RedirectTo(GURL(*result.redirectUrl));
+        return true;
+    }
+    for (const auto &[name, value] : result.headers) {
+        if (base::EqualsCaseInsensitiveASCII(name, "referer"))
+            request_.referrer = value ? GURL(*value) : GURL();
+        else if (value)
+            request_.headers.SetHeader(name, *value);
+        else
+            request_.headers.RemoveHeader(name);
+    }
+    return false;
+}
+
+void InterceptedRequest::RedirectTo(const GURL &url)
+{
+    net::RedirectInfo::FirstPartyURLPolicy first_party_url_policy =
+            request_.update_first_party_url_on_redirect ? net::RedirectInfo::FirstPartyURLPolicy::UPDATE_URL_ON_REDIRECT
+                                                        : net::RedirectInfo::FirstPartyURLPolicy::NEVER_CHANGE_URL;
+    net::RedirectInfo redirectInfo = net::RedirectInfo::ComputeRedirectInfo(
+            request_.method, request_.url, request_.site_for_cookies,
+            first_party_url_policy, request_.referrer_policy, request_.referrer.spec(),
+            net::HTTP_TEMPORARY_REDIRECT, url, std::nullopt,
+            false /*insecure_scheme_was_upgraded*/);
+    request_.method = redirectInfo.new_method;
+    request_.url = redirectInfo.new_url;
+    request_.site_for_cookies = redirectInfo.new_site_for_cookies;
+    request_.referrer = GURL(redirectInfo.new_referrer);
+    request_.referrer_policy = redirectInfo.new_referrer_policy;
+    if (request_.method == net::HttpRequestHeaders::kGetMethod)
+        request_.request_body = nullptr;
+    // In case of multiple sequential rediredts, current_response_ has previously been moved to target_client_
+    // so we create a new one using the redirect url.
+    if (!current_response_)
+        current_response_ = createResponse(request_);
+    current_response_->encoded_data_length = 0;
+    target_client_->OnReceiveRedirect(redirectInfo, std::move(current_response_));
+}
+
 // URLLoaderClient methods.
 
 void InterceptedRequest::OnReceiveResponse(network::mojom::URLResponseHeadPtr head, mojo::ScopedDataPipeConsumerHandle handle, std::optional<mojo_base::BigBuffer> buffer)
 {
+    InterceptResponse(head, handle);
     current_response_ = head.Clone();
 
     target_client_->OnReceiveResponse(std::move(head), std::move(handle), std::move(buffer));
 }
 
+// Lets the profile's response interceptor change the headers, and swaps the
+// body for a transformed stream if it asked for that.
+void InterceptedRequest::InterceptResponse(network::mojom::URLResponseHeadPtr &head,
+                                           mojo::ScopedDataPipeConsumerHandle &body)
+{
+    QWebEngineUrlResponseInterceptor *interceptor =
+            profile_adapter_ ? profile_adapter_->responseInterceptor() : nullptr;
+    if (!interceptor)
+        return;
+
+    QMultiHash<QByteArray, QByteArray> headers;
+    int statusCode = 0;
+    if (head->headers) {
+        statusCode = head->headers->response_code();
+        size_t iter = 0;
+        std::string name, value;
+        while (head->headers->EnumerateHeaderLines(&iter, &name, &value))
+            headers.insert(QByteArray::fromStdString(name), QByteArray::fromStdString(value));
+    }
+    QWebEngineUrlResponseInfo info(new QWebEngineUrlResponseInfoPrivate(
+            toQt(request_.url), toQt(blink::mojom::ResourceType(request_.resource_type)),
+            statusCode, headers));
+    interceptor->interceptResponse(info);
+
+    QWebEngineUrlResponseInfoPrivate &d = *info.d_ptr;
+    if (!d.headerChanges.isEmpty() && head->headers) {
+        for (const auto &[name, value] : std::as_const(d.headerChanges)) {
+            if (value)
+                head->headers->SetHeader(name.toStdString(), value->toStdString());
+            else
+                head->headers->RemoveHeader(name.toStdString());
+        }
+        std::string mimeType;
+        if (head->headers->GetMimeType(&mimeType))
+            head->mime_type = mimeType;
+    }
+    if (d.bodyTransformer && body) {
+        if (head->headers)
+            head->headers->RemoveHeader("Content-Length");
+        head->content_length = -1;
+        body = ResponseBodyTransformerQt::Start(std::move(body), std::move(d.bodyTransformer));
+    }
+}
+
 void InterceptedRequest::OnReceiveRedirect(const net::RedirectInfo &redirect_info, network::mojom::URLResponseHeadPtr head)
 {
     // TODO(timvolodine): handle redirect override.
@@ -451,12 +626,56 @@ void InterceptedRequest::OnTransferSizeUpdated(int32_t transfer_size_diff)
 
 void InterceptedRequest::OnComplete(const network::URLLoaderCompletionStatus &status)
 {
+    RecordRequest(status);
     // Only wait for the original loader to possibly have a custom error if the
     // target loader succeeded. If the target loader failed, then it was a race as
     // to whether that error or the safe browsing error would be reported.
     CallOnComplete(status, status.error_code == net::OK);
 }
 
+static qint64 durationBetween(base::TimeTicks start, base::TimeTicks end)
+{
+    if (start.is_null() || end.is_null() || end < start)
+        return -1;
+    return (end - start).InMicroseconds();
+}
+
+// Adds the finished request to the log of its page, if the page keeps one.
+void InterceptedRequest::RecordRequest(const network::URLLoaderCompletionStatus &status)
+{
+    NetworkRequestLog *log = getNetworkRequestLog();
+    if (!log)
+        return;
+
+    NetworkRequestEntry entry;
+    entry.url = toQt(request_.url);
+    if (request_.request_initiator)
+        entry.initiator = toQt(request_.request_initiator->GetURL());
+    entry.resourceType = toQt(blink::mojom::ResourceType(request_.resource_type));
+    entry.error = status.error_code;
+    entry.fromCache = status.exists_in_cache;
+    entry.encodedDataLength = status.encoded_data_length;
+    entry.encodedBodyLength = status.encoded_body_length;
+    entry.decodedBodyLength = status.decoded_body_length;
+    if (current_response_) {
+        if (current_response_->headers)
+            entry.statusCode = current_response_->headers->response_code();
+        entry.fromCache = entry.fromCache || current_response_->was_fetched_via_cache;
+
+        const net::LoadTimingInfo &timing = current_response_->load_timing;
+        const net::LoadTimingInfo::ConnectTiming &connect = timing.connect_timing;
+        const base::TimeTicks firstByte = timing.receive_headers_start.is_null()
+                ? timing.receive_headers_end : timing.receive_headers_start;
+        entry.dnsDuration = durationBetween(connect.domain_lookup_start, connect.domain_lookup_end);
+        entry.connectDuration = durationBetween(connect.connect_start, connect.connect_end);
+        entry.sslDuration = durationBetween(connect.ssl_start, connect.ssl_end);
+        entry.timeToFirstByte = durationBetween(timing.request_start, firstByte);
+        entry.downloadDuration = durationBetween(timing.receive_headers_end, status.completion_time);
+        entry.totalDuration = durationBetween(timing.request_start, status.completion_time);
+    }
+    log->add(std::move(entry));
+}
+
 // URLLoader methods.
 
 void InterceptedRequest::FollowRedirect(const std::vector<std::string> &removed_headers,
@@ -547,6 +766,8 @@ void InterceptedRequest::SendErrorAndCompleteImmediately(int error_code)
 {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
     auto status = network::URLLoaderCompletionStatus(error_code);
+    // Requests blocked before reaching the network are logged too.
+    RecordRequest(status);
     target_client_->OnComplete(status);
     delete this;
 }
@@ -5,17 +5,134 @@
 
 #include <QtWebEngineCore/qwebengineurlrequestjob.h>
 
-#include <QFile>
-#include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
 #include <QMimeDatabase>
 #include <QMimeType>
+#include <QMutex>
+#include <QResource>
 
 #include <memory>
+#include <optional>
 
 using namespace Qt::StringLiterals;
 
 namespace QtWebEngineCore {
 
+namespace {
+
+// Mime types and decompressed data of the resources served so far, shared by
+// the handlers of all profiles since resources are registered for the whole
+// process. Resources can be registered and unregistered at any time, so they
+// are resolved for every request, and an entry is only used while the
+// resource registered under its path still has the same data, size and
+// modification time.
+class ResourceIndex
+{
+public:
+    struct Resource
+    {
+        QByteArray mimeType;
+        QByteArray data;
+        // Set when data points into the resource. Holding it keeps the data of a
+        // resource file mapped even if the file is unregistered meanwhile.
+        std::shared_ptr<const QResource> source;
+    };
+
+    static ResourceIndex &instance()
+    {
+        static ResourceIndex index;
+        return index;
+    }
+
+    std::optional<Resource> resource(const QString &path)
+    {
+        auto source = std::make_shared<const QResource>(path);
+        const QResource &resource = *source;
+        if (!resource.isValid() || resource.isDir() || resource.size() == 0)
+            return std::nullopt;
+
+        const bool compressed = resource.compressionAlgorithm() != QResource::NoCompression;
+        Resource result;
+        if (!compressed) {
+            // Points into the resource data, like a QFile reading the resource would.
+            result.data = QByteArray::fromRawData(reinterpret_cast<const char *>(resource.data()),
+                                                  resource.size());
+            result.source = std::move(source);
+        }
+
+        {
+            QMutexLocker locker(&m_mutex);
+            const auto it = m_entries.constFind(path);
+            if (it != m_entries.cend() && it->matches(resource)
+                && (!compressed || !it->decompressedData.isNull())) {
+                result.mimeType = it->mimeType;
+                if (compressed)
+                    result.data = it->decompressedData;
+                return result;
+            }
+        }
+
+        if (compressed)
+            result.data = resource.uncompressedData();
+        const QMimeType mimeType = QMimeDatabase().mimeTypeForFileNameAndData(path, result.data);
+        result.mimeType = mimeType.name() == "application/x-extension-html"_L1
+                ? QByteArrayLiteral("text/html")
+                : mimeType.name().toUtf8();
+
+        Entry entry;
+        entry.source = resource.data();
+        entry.size = resource.size();
+        entry.lastModified = resource.lastModified();
+        entry.mimeType = result.mimeType;
+
+        QMutexLocker locker(&m_mutex);
+        const auto it = m_entries.constFind(path);
+        if (it != m_entries.cend())
+            m_decompressedSize -= it->decompressedData.size();
+        // Decompressed data is only kept within a budget, and decompressed
+        // again for every request beyond it.
+        if (compressed && m_decompressedSize + result.data.size() <= kMaxDecompressedSize) {
+            entry.decompressedData = result.data;
+            m_decompressedSize += result.data.size();
+        }
+        m_entries.insert(path, std::move(entry));
+        return result;
+    }
+
+private:
+    struct Entry
+    {
+        // These identify the registered resource and are never dereferenced.
+        const uchar *source = nullptr;
+        qint64 size = 0;
+        QDateTime lastModified;
+
+        QByteArray mimeType;
+        QByteArray decompressedData;
+
+        bool matches(const QResource &resource) const
+        {
+            return source == resource.data() && size == resource.size()
+                    && lastModified == resource.lastModified();
+        }
+    };
+
+    static constexpr qint64 kMaxDecompressedSize = 64 * 1024 * 1024;
+
+    QMutex m_mutex;
+    QHash<QString, Entry> m_entries;
+    qint64 m_decompressedSize = 0;
+};
+
+} // namespace
+
+QrcUrlSchemeHandler::QrcUrlSchemeHandler()
+{
+    // Resources are read-only and the index is thread-safe.
+    setThreadingMode(ThreadingMode::ThreadPool);
+}
+
 void QrcUrlSchemeHandler::requestStarted(QWebEngineUrlRequestJob *job)
 {
     QByteArray requestMethod = job->requestMethod();
@@ -26,19 +143,17 @@ void QrcUrlSchemeHandler::requestStarted(QWebEngineUrlRequestJob *job)
 
     QUrl requestUrl = job->requestUrl();
     QString requestPath = requestUrl.path();
-    auto file = std::make_unique<QFile>(u':' + requestPath, job);
-    if (!file->exists() || file->size() == 0) {
+    const std::optional<ResourceIndex::Resource> resource =
+            ResourceIndex::instance().resource(u':' + requestPath);
+    if (!resource) {
         qWarning("QResource '%s' not found or is empty", qUtf8Printable(requestPath));
         job->fail(QWebEngineUrlRequestJob::UrlNotFound);
         return;
     }
-    QFileInfo fileInfo(*file);
-    QMimeDatabase mimeDatabase;
-    QMimeType mimeType = mimeDatabase.mimeTypeForFile(fileInfo);
-    if (mimeType.name() == "application/x-extension-html"_L1)
-        job->reply("text/html", file.release());
-    else
-        job->reply(mimeType.name().toUtf8(), file.release());
+    // The data is read until the job is deleted, so it keeps the resource.
+    if (resource->source)
+        QObject::connect(job, &QObject::destroyed, [source = resource->source]() { });
+    job->reply(resource->mimeType, resource->data);
 }
 
 } // namespace QtWebEngineCore
@@ -12,6 +12,7 @@ namespace QtWebEngineCore {
 class QrcUrlSchemeHandler final : public QWebEngineUrlSchemeHandler
 {
 public:
+    QrcUrlSchemeHandler();
     void requestStarted(QWebEngineUrlRequestJob *) override;
 };
 
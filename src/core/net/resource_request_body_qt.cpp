@@ -5,17 +5,41 @@
 #include "type_conversion.h"
 
 #include "services/network/public/cpp/resource_request_body.h"
+#include "services/network/public/mojom/chunked_data_pipe_getter.mojom.h"
 #include "services/network/public/mojom/data_pipe_getter.mojom.h"
 #include "services/network/public/mojom/url_request.mojom-shared.h"
+#include "base/task/sequenced_task_runner.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
+#include "mojo/public/cpp/system/wait.h"
+#include "net/base/net_errors.h"
+
+#include <QtCore/QPointer>
 
 using namespace Qt::StringLiterals;
 
 namespace QtWebEngineCore {
 
-ResourceRequestBody::ResourceRequestBody(network::ResourceRequestBody *requestBody, QObject *parent)
+static bool isPipe(network::mojom::DataElementDataView::Tag type)
+{
+    return type == network::mojom::DataElementDataView::Tag::kDataPipe
+            || type == network::mojom::DataElementDataView::Tag::kChunkedDataPipe;
+}
+
+// The data pipe element currently being read, and the getter filling it.
+struct ResourceRequestBody::PipeReader
+{
+    mojo::Remote<network::mojom::DataPipeGetter> pipeGetter;
+    mojo::Remote<network::mojom::ChunkedDataPipeGetter> chunkedPipeGetter;
+    mojo::ScopedDataPipeConsumerHandle consumerHandle;
+    std::unique_ptr<mojo::SimpleWatcher> watcher;
+};
+
+ResourceRequestBody::ResourceRequestBody(network::ResourceRequestBody *requestBody,
+                                         ReadMode readMode, QObject *parent)
     : QIODevice(parent)
     , m_requestBody(requestBody)
+    , m_readMode(readMode)
     , m_dataElementsIdx(0)
     , m_dataElementBytesIdx(0)
     , m_dataElementFileIdx(0)
@@ -23,6 +47,46 @@ ResourceRequestBody::ResourceRequestBody(network::ResourceRequestBody *requestBo
 
 ResourceRequestBody::~ResourceRequestBody(){};
 
+bool ResourceRequestBody::open(OpenMode mode)
+{
+    if (!QIODevice::open(mode))
+        return false;
+    if (m_readMode != ReadMode::Streaming || !m_requestBody)
+        return true;
+
+    // Start filling the first data pipe right away, so that readyRead() follows
+    // once its data arrives. Data that is available already is announced as well.
+    const std::vector<network::DataElement> *elements = m_requestBody->elements();
+    for (std::size_t i = m_dataElementsIdx; i < elements->size(); ++i) {
+        if (isPipe(elements->at(i).type())) {
+            if (!m_pipe)
+                startPipe(i);
+            break;
+        }
+    }
+    if (m_dataElementsIdx < elements->size() && !isPipe(elements->at(m_dataElementsIdx).type())
+        && base::SequencedTaskRunner::HasCurrentDefault()) {
+        base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+                FROM_HERE, base::BindOnce([](QPointer<ResourceRequestBody> body) {
+                    if (body && body->isOpen())
+                        Q_EMIT body->readyRead();
+                }, QPointer<ResourceRequestBody>(this)));
+    }
+    return true;
+}
+
+void ResourceRequestBody::close()
+{
+    m_pipe.reset();
+    QIODevice::close();
+}
+
+bool ResourceRequestBody::atEnd() const
+{
+    return QIODevice::atEnd()
+            && (!m_requestBody || m_dataElementsIdx == m_requestBody->elements()->size());
+}
+
 qint64 ResourceRequestBody::readData(char *data, qint64 maxSize)
 {
     if (!m_requestBody)
@@ -50,20 +114,14 @@ qint64 ResourceRequestBody::readData(char *data, qint64 maxSize)
                 readDataElementFile(file.path(), offset, length, bytesRead, maxSize, &data);
                 break;
             }
-            case network::mojom::DataElementDataView::Tag::kDataPipe: {
-                mojo::Remote<network::mojom::DataPipeGetter> pipeGetter;
-                pipeGetter.Bind(
-                        currentDataElement.As<network::DataElementDataPipe>().CloneDataPipeGetter());
-                const mojo::ScopedHandleBase<mojo::DataPipeConsumerHandle> consumerHandle =
-                        getConsumerHandleFromPipeGetter(pipeGetter);
-                readDataElementPipe(consumerHandle, bytesRead, maxSize, &data);
-                break;
-            }
+            case network::mojom::DataElementDataView::Tag::kDataPipe:
             case network::mojom::DataElementDataView::Tag::kChunkedDataPipe: {
-                setErrorString(QStringLiteral("Chunked data pipe is used in request body upload, which "
-                                              "is currently not supported"));
-                // Nothing should come before or after DataElementChunkedDataPipe
-                return -1;
+                if (!m_pipe && !startPipe(m_dataElementsIdx))
+                    return bytesRead > 0 ? bytesRead : -1;
+                // In streaming mode, return what we have and wait for readyRead().
+                if (!readDataElementPipe(bytesRead, maxSize, &data))
+                    return bytesRead;
+                break;
             }
         }
 
@@ -135,46 +193,102 @@ void ResourceRequestBody::readDataElementFile(const base::FilePath &filePath, co
     }
 }
 
-mojo::ScopedHandleBase<mojo::DataPipeConsumerHandle>
-ResourceRequestBody::getConsumerHandleFromPipeGetter(
-        mojo::Remote<network::mojom::DataPipeGetter> &pipeGetter)
+bool ResourceRequestBody::startPipe(std::size_t dataElementIdx)
 {
-    mojo::ScopedHandleBase<mojo::DataPipeProducerHandle> producerHandle;
-    mojo::ScopedHandleBase<mojo::DataPipeConsumerHandle> consumerHandle;
-    mojo::CreateDataPipe(nullptr, producerHandle, consumerHandle);
-    base::WeakPtrFactory<ResourceRequestBody> weakPtrFactory{ this };
-    pipeGetter->Read(std::move(producerHandle),
-                     base::BindOnce(&ResourceRequestBody::pipeGetterOnReadComplete,
-                                    weakPtrFactory.GetWeakPtr()));
-
-    return consumerHandle;
+    network::DataElement &element = m_requestBody->elements_mutable()->at(dataElementIdx);
+    auto pipe = std::make_unique<PipeReader>();
+    mojo::ScopedDataPipeProducerHandle producerHandle;
+    if (mojo::CreateDataPipe(nullptr, producerHandle, pipe->consumerHandle) != MOJO_RESULT_OK) {
+        setErrorString(QStringLiteral("Could not create a data pipe for the request body"));
+        return false;
+    }
+
+    if (element.type() == network::mojom::DataElementDataView::Tag::kDataPipe) {
+        pipe->pipeGetter.Bind(element.As<network::DataElementDataPipe>().CloneDataPipeGetter());
+        pipe->pipeGetter->Read(std::move(producerHandle),
+                               base::BindOnce(&ResourceRequestBody::pipeGetterOnReadComplete,
+                                              base::Unretained(this)));
+    } else {
+        // A chunked data pipe can only be read once, which takes it away from any
+        // other consumer of the request, so only jobs reading it as a stream do.
+        auto &chunkedPipe = element.As<network::DataElementChunkedDataPipe>();
+        if (m_readMode != ReadMode::Streaming || !chunkedPipe.chunked_data_pipe_getter()) {
+            setErrorString(QStringLiteral("Chunked data pipe is used in request body upload, which "
+                                          "is currently not supported"));
+            return false;
+        }
+        pipe->chunkedPipeGetter.Bind(chunkedPipe.ReleaseChunkedDataPipeGetter());
+        pipe->chunkedPipeGetter->GetSize(base::BindOnce(
+                &ResourceRequestBody::pipeGetterOnReadComplete, base::Unretained(this)));
+        pipe->chunkedPipeGetter->StartReading(std::move(producerHandle));
+    }
+
+    if (m_readMode == ReadMode::Streaming && base::SequencedTaskRunner::HasCurrentDefault()) {
+        pipe->watcher = std::make_unique<mojo::SimpleWatcher>(
+                FROM_HERE, mojo::SimpleWatcher::ArmingPolicy::MANUAL);
+        pipe->watcher->Watch(pipe->consumerHandle.get(),
+                             MOJO_HANDLE_SIGNAL_READABLE | MOJO_HANDLE_SIGNAL_PEER_CLOSED,
+                             base::BindRepeating(&ResourceRequestBody::pipeReadable,
+                                                 base::Unretained(this)));
+        pipe->watcher->ArmOrNotify();
+    }
+    m_pipe = std::move(pipe);
+    return true;
 }
 
-void ResourceRequestBody::readDataElementPipe(
-        const mojo::ScopedHandleBase<mojo::DataPipeConsumerHandle> &consumerHandle,
-        qint64 &bytesRead, qint64 maxSize, char **data)
+// Returns false if the pipe has no data yet and the read should continue on readyRead().
+bool ResourceRequestBody::readDataElementPipe(qint64 &bytesRead, qint64 maxSize, char **data)
 {
-    MojoResult result;
-    do {
-        size_t bytesToRead = 1;
-        base::span<uint8_t> buffer = base::make_span(reinterpret_cast<uint8_t*>(*data), reinterpret_cast<uint8_t*>(*data) + maxSize);
-        result = consumerHandle->ReadData(MOJO_READ_DATA_FLAG_NONE, buffer, bytesToRead);
+    while (bytesRead < maxSize) {
+        size_t bytesToRead = 0;
+        base::span<uint8_t> buffer = base::make_span(reinterpret_cast<uint8_t *>(*data),
+                                                     static_cast<size_t>(maxSize - bytesRead));
+        const MojoResult result =
+                m_pipe->consumerHandle->ReadData(MOJO_READ_DATA_FLAG_NONE, buffer, bytesToRead);
 
         if (result == MOJO_RESULT_OK) {
             *data += bytesToRead;
             bytesRead += bytesToRead;
-            maxSize -= bytesToRead;
-        } else if (result != MOJO_RESULT_SHOULD_WAIT && result != MOJO_RESULT_FAILED_PRECONDITION) {
+            continue;
+        }
+        if (result == MOJO_RESULT_SHOULD_WAIT) {
+            if (m_readMode == ReadMode::Streaming) {
+                // Nothing is read from the pipe until the handler asks for more, which
+                // lets the pipe fill up and hold back the sender.
+                if (m_pipe->watcher)
+                    m_pipe->watcher->ArmOrNotify();
+                return false;
+            }
+            mojo::Wait(m_pipe->consumerHandle.get(),
+                       MOJO_HANDLE_SIGNAL_READABLE | MOJO_HANDLE_SIGNAL_PEER_CLOSED);
+            continue;
+        }
+        if (result != MOJO_RESULT_FAILED_PRECONDITION) {
             setErrorString(QString::fromLatin1("Error while reading from data pipe, skipping"
                                                "remaining content of data pipe. Mojo error code: ")
                            + QString::number(result));
         }
-    } while ((result == MOJO_RESULT_SHOULD_WAIT || result == MOJO_RESULT_OK)
-             && maxSize > 0);
+        // The producer is done with the pipe.
+        m_pipe.reset();
+        m_dataElementsIdx++;
+        return true;
+    }
+    return true;
+}
 
-    m_dataElementsIdx++;
+void ResourceRequestBody::pipeGetterOnReadComplete(int32_t status, uint64_t size)
+{
+    Q_UNUSED(size);
+    if (status != net::OK)
+        setErrorString(QStringLiteral("Error while reading request body: ")
+                       + QString::fromStdString(net::ErrorToString(status)));
 }
 
-void ResourceRequestBody::pipeGetterOnReadComplete(int32_t status, uint64_t size) { }
+void ResourceRequestBody::pipeReadable(MojoResult result)
+{
+    Q_UNUSED(result);
+    // Also emitted when the pipe is closed, so that the reader sees the end of it.
+    Q_EMIT readyRead();
+}
 
 } // namespace QtWebEngineCore
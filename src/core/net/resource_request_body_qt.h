@@ -9,6 +9,8 @@
 #include <QtCore/QFile>
 #include <QtCore/QUrl>
 
+#include <memory>
+
 namespace network {
 class ResourceRequestBody;
 namespace mojom {
@@ -21,13 +23,7 @@ namespace base {
 class FilePath;
 }
 
-namespace mojo {
-template<typename T>
-class Remote;
-template<typename T>
-class ScopedHandleBase;
-class DataPipeConsumerHandle;
-}
+typedef uint32_t MojoResult;
 
 namespace QtWebEngineCore {
 
@@ -35,16 +31,28 @@ class Q_WEBENGINECORE_EXPORT ResourceRequestBody : public QIODevice
 {
     Q_OBJECT
 public:
+    // Blocking reads wait until data pipes are drained. Streaming reads only return
+    // what has arrived so far and emit readyRead() when more data is available.
+    enum class ReadMode { Blocking, Streaming };
+
     explicit ResourceRequestBody(network::ResourceRequestBody *requestBody,
+                                 ReadMode readMode = ReadMode::Blocking,
                                  QObject *parent = nullptr);
     ~ResourceRequestBody();
 
+    bool open(OpenMode mode) override;
+    void close() override;
+    bool atEnd() const override;
     qint64 readData(char *data, qint64 maxSize) override;
     qint64 writeData(const char *data, qint64 maxSize) override;
     bool isSequential() const override;
 
 private:
+    struct PipeReader;
+
     network::ResourceRequestBody *const m_requestBody;
+    const ReadMode m_readMode;
+    std::unique_ptr<PipeReader> m_pipe;
 
     std::size_t m_dataElementsIdx;
     std::size_t m_dataElementBytesIdx;
@@ -55,12 +63,10 @@ private:
     void readDataElementFile(const base::FilePath &filePath, const qint64 &offset,
                              const qint64 &length, qint64 &bytesRead, const qint64 &maxSize,
                              char **data);
-    mojo::ScopedHandleBase<mojo::DataPipeConsumerHandle>
-    getConsumerHandleFromPipeGetter(mojo::Remote<network::mojom::DataPipeGetter> &pipeGetter);
-    void
-    readDataElementPipe(const mojo::ScopedHandleBase<mojo::DataPipeConsumerHandle> &consumerHandle,
-                        qint64 &bytesRead, qint64 maxSize, char **data);
+    bool startPipe(std::size_t dataElementIdx);
+    bool readDataElementPipe(qint64 &bytesRead, qint64 maxSize, char **data);
     void pipeGetterOnReadComplete(int32_t status, uint64_t size);
+    void pipeReadable(MojoResult result);
 };
 
 } // namespace QtWebEngineCore
@@ -0,0 +1,133 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "response_body_transformer_qt.h"
+
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
+
+#include "api/qwebengineurlresponseinfo.h"
+
+namespace QtWebEngineCore {
+
+mojo::ScopedDataPipeConsumerHandle
+ResponseBodyTransformerQt::Start(mojo::ScopedDataPipeConsumerHandle body,
+                                 std::unique_ptr<QWebEngineUrlResponseBodyTransformer> transformer)
+{
+    if (!body || !transformer)
+        return body;
+
+    mojo::ScopedDataPipeProducerHandle producerHandle;
+    mojo::ScopedDataPipeConsumerHandle consumerHandle;
+    if (mojo::CreateDataPipe(nullptr, producerHandle, consumerHandle) != MOJO_RESULT_OK) {
+        qWarning("Could not create a pipe for the transformed response body, "
+                 "passing it on unchanged.");
+        return body;
+    }
+
+    // The transformer is application code that may take its time, so it runs
+    // off the UI thread, one chunk after the other.
+    auto taskRunner = base::ThreadPool::CreateSequencedTaskRunner(
+            { base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+              base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN });
+    auto *self = new ResponseBodyTransformerQt(std::move(body), std::move(producerHandle),
+                                               std::move(transformer));
+    taskRunner->PostTask(FROM_HERE, base::BindOnce(&ResponseBodyTransformerQt::Begin,
+                                                   base::Unretained(self)));
+    return consumerHandle;
+}
+
+ResponseBodyTransformerQt::ResponseBodyTransformerQt(
+        mojo::ScopedDataPipeConsumerHandle source, mojo::ScopedDataPipeProducerHandle destination,
+        std::unique_ptr<QWebEngineUrlResponseBodyTransformer> transformer)
+    : m_source(std::move(source))
+    , m_destination(std::move(destination))
+    , m_transformer(std::move(transformer))
+{
+}
+
+ResponseBodyTransformerQt::~ResponseBodyTransformerQt() = default;
+
+void ResponseBodyTransformerQt::Begin()
+{
+    const auto callback = base::BindRepeating(&ResponseBodyTransformerQt::OnHandleReady,
+                                              base::Unretained(this));
+    m_sourceWatcher = std::make_unique<mojo::SimpleWatcher>(
+            FROM_HERE, mojo::SimpleWatcher::ArmingPolicy::MANUAL);
+    m_sourceWatcher->Watch(m_source.get(), MOJO_HANDLE_SIGNAL_READABLE,
+                           MOJO_WATCH_CONDITION_SATISFIED, callback);
+    m_destinationWatcher = std::make_unique<mojo::SimpleWatcher>(
+            FROM_HERE, mojo::SimpleWatcher::ArmingPolicy::MANUAL);
+    m_destinationWatcher->Watch(m_destination.get(), MOJO_HANDLE_SIGNAL_WRITABLE,
+                                MOJO_WATCH_CONDITION_SATISFIED, callback);
+    Pump(); // May delete this
+}
+
+void ResponseBodyTransformerQt::OnHandleReady(MojoResult, const mojo::HandleSignalsState &)
+{
+    // Errors surface from the next read or write.
+    Pump(); // May delete this
+}
+
+void ResponseBodyTransformerQt::Pump()
+{
+    for (;;) {
+        switch (Flush()) {
+        case FlushResult::Done:
+            break;
+        case FlushResult::Waiting:
+            return;
+        case FlushResult::Failed:
+            delete this;
+            return;
+        }
+        if (m_finished) {
+            // Closing the producer ends the body for the page.
+            delete this;
+            return;
+        }
+
+        base::span<const uint8_t> buffer;
+        const MojoResult result = m_source->BeginReadData(MOJO_READ_DATA_FLAG_NONE, buffer);
+        if (result == MOJO_RESULT_SHOULD_WAIT) {
+            m_sourceWatcher->ArmOrNotify();
+            return;
+        }
+        if (result != MOJO_RESULT_OK) {
+            // The network side closed the pipe, which is the end of the body.
+            m_pending = m_transformer->finish();
+            m_pendingOffset = 0;
+            m_finished = true;
+            continue;
+        }
+        m_pending = m_transformer->transform(
+                QByteArrayView(reinterpret_cast<const char *>(buffer.data()),
+                               qsizetype(buffer.size())));
+        m_pendingOffset = 0;
+        m_source->EndReadData(buffer.size());
+    }
+}
+
+ResponseBodyTransformerQt::FlushResult ResponseBodyTransformerQt::Flush()
+{
+    while (m_pendingOffset < m_pending.size()) {
+        size_t bytesWritten = 0;
+        const MojoResult result = m_destination->WriteData(
+                base::make_span(reinterpret_cast<const uint8_t *>(m_pending.constData())
+                                        + m_pendingOffset,
+                                size_t(m_pending.size() - m_pendingOffset)),
+                MOJO_WRITE_DATA_FLAG_NONE, bytesWritten);
+        if (result == MOJO_RESULT_SHOULD_WAIT) {
+            m_destinationWatcher->ArmOrNotify();
+            return FlushResult::Waiting;
+        }
+        if (result != MOJO_RESULT_OK)
+            return FlushResult::Failed; // The page stopped reading.
+        m_pendingOffset += qsizetype(bytesWritten);
+    }
+    m_pending.clear();
+    m_pendingOffset = 0;
+    return FlushResult::Done;
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef RESPONSE_BODY_TRANSFORMER_QT_H
+#define RESPONSE_BODY_TRANSFORMER_QT_H
+
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
+
+#include <QtCore/qbytearray.h>
+
+#include <memory>
+
+QT_FORWARD_DECLARE_CLASS(QWebEngineUrlResponseBodyTransformer)
+
+namespace QtWebEngineCore {
+
+// Pumps a response body from the network through a
+// QWebEngineUrlResponseBodyTransformer into a new data pipe, on a worker
+// sequence. Nothing more is read while the output of the last chunk is still
+// waiting for room in the pipe, so the page consuming the body throttles the
+// network side and only one chunk is held at a time. Deletes itself once the
+// body is done or either side goes away.
+class ResponseBodyTransformerQt
+{
+public:
+    // Starts transforming |body| and returns the pipe the result arrives on.
+    static mojo::ScopedDataPipeConsumerHandle
+    Start(mojo::ScopedDataPipeConsumerHandle body,
+          std::unique_ptr<QWebEngineUrlResponseBodyTransformer> transformer);
+
+    ~ResponseBodyTransformerQt();
+
+private:
+    enum class FlushResult { Done, Waiting, Failed };
+
+    ResponseBodyTransformerQt(mojo::ScopedDataPipeConsumerHandle source,
+                              mojo::ScopedDataPipeProducerHandle destination,
+                              std::unique_ptr<QWebEngineUrlResponseBodyTransformer> transformer);
+
+    void Begin();
+    void Pump();
+    FlushResult Flush();
+    void OnHandleReady(MojoResult result, const mojo::HandleSignalsState &state);
+
+    mojo::ScopedDataPipeConsumerHandle m_source;
+    mojo::ScopedDataPipeProducerHandle m_destination;
+    std::unique_ptr<QWebEngineUrlResponseBodyTransformer> m_transformer;
+    std::unique_ptr<mojo::SimpleWatcher> m_sourceWatcher;
+    std::unique_ptr<mojo::SimpleWatcher> m_destinationWatcher;
+
+    // Output not yet written to |m_destination|.
+    QByteArray m_pending;
+    qsizetype m_pendingOffset = 0;
+    // Whether the whole body has been transformed, and only |m_pending| is left.
+    bool m_finished = false;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // RESPONSE_BODY_TRANSFORMER_QT_H
@@ -17,13 +17,15 @@ namespace QtWebEngineCore {
 URLRequestCustomJobDelegate::URLRequestCustomJobDelegate(
         URLRequestCustomJobProxy *proxy, const QUrl &url, const QByteArray &method,
         const QUrl &initiatorOrigin, const QMap<QByteArray, QByteArray> &headers,
-        network::ResourceRequestBody *requestBody)
+        network::ResourceRequestBody *requestBody, ResourceRequestBody::ReadMode readMode,
+        net::RequestPriority priority)
     : m_proxy(proxy)
     , m_request(url)
     , m_method(method)
     , m_initiatorOrigin(initiatorOrigin)
     , m_requestHeaders(headers)
-    , m_resourceRequestBody(ResourceRequestBody(requestBody))
+    , m_resourceRequestBody(requestBody, readMode)
+    , m_priority(priority)
 {
 }
 
@@ -56,6 +58,11 @@ QIODevice *URLRequestCustomJobDelegate::requestBody()
     return &m_resourceRequestBody;
 }
 
+net::RequestPriority URLRequestCustomJobDelegate::priority() const
+{
+    return m_priority;
+}
+
 void URLRequestCustomJobDelegate::setAdditionalResponseHeaders(
         const QMultiMap<QByteArray, QByteArray> &additionalResponseHeaders)
 {
@@ -68,7 +75,12 @@ void URLRequestCustomJobDelegate::reply(const QByteArray &contentType, QIODevice
         m_proxy->m_ioTaskRunner->PostTask(FROM_HERE,
                                           base::BindOnce(&URLRequestCustomJobProxy::succeed, m_proxy));
     else {
-        QObject::connect(device, &QIODevice::readyRead, this, &URLRequestCustomJobDelegate::slotReadyRead);
+        // Worker threads of ThreadPool mode handlers have no event loop to deliver
+        // a queued signal, and the slot only posts to the IO thread.
+        const Qt::ConnectionType type =
+                m_proxy->m_threadPoolAccess ? Qt::DirectConnection : Qt::AutoConnection;
+        QObject::connect(device, &QIODevice::readyRead, this,
+                         &URLRequestCustomJobDelegate::slotReadyRead, type);
         m_proxy->m_ioTaskRunner->PostTask(FROM_HERE,
                                           base::BindOnce(&URLRequestCustomJobProxy::reply, m_proxy,
                                                          contentType.toStdString(), device,
@@ -76,6 +88,14 @@ void URLRequestCustomJobDelegate::reply(const QByteArray &contentType, QIODevice
     }
 }
 
+void URLRequestCustomJobDelegate::reply(const QByteArray &contentType, const QByteArray &data)
+{
+    m_proxy->m_ioTaskRunner->PostTask(FROM_HERE,
+                                      base::BindOnce(&URLRequestCustomJobProxy::replyWithData, m_proxy,
+                                                     contentType.toStdString(), data,
+                                                     std::move(m_additionalResponseHeaders)));
+}
+
 void URLRequestCustomJobDelegate::slotReadyRead()
 {
     m_proxy->m_ioTaskRunner->PostTask(FROM_HERE,
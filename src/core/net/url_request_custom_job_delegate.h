@@ -16,6 +16,7 @@
 #define URL_REQUEST_CUSTOM_JOB_DELEGATE_H_
 
 #include "base/memory/ref_counted.h"
+#include "net/base/request_priority.h"
 #include "qtwebenginecoreglobal_p.h"
 #include "resource_request_body_qt.h"
 
@@ -53,10 +54,12 @@ public:
     QUrl initiator() const;
     QMap<QByteArray, QByteArray> requestHeaders() const;
     QIODevice *requestBody();
+    net::RequestPriority priority() const;
 
     void
     setAdditionalResponseHeaders(const QMultiMap<QByteArray, QByteArray> &additionalResponseHeaders);
     void reply(const QByteArray &contentType, QIODevice *device);
+    void reply(const QByteArray &contentType, const QByteArray &data);
     void redirect(const QUrl &url);
     void abort();
     void fail(Error);
@@ -68,7 +71,9 @@ private:
     URLRequestCustomJobDelegate(URLRequestCustomJobProxy *proxy, const QUrl &url,
                                 const QByteArray &method, const QUrl &initiatorOrigin,
                                 const QMap<QByteArray, QByteArray> &requestHeaders,
-                                network::ResourceRequestBody *requestBody);
+                                network::ResourceRequestBody *requestBody,
+                                ResourceRequestBody::ReadMode readMode,
+                                net::RequestPriority priority);
 
     friend class URLRequestCustomJobProxy;
     scoped_refptr<URLRequestCustomJobProxy> m_proxy;
@@ -78,6 +83,8 @@ private:
     const QMap<QByteArray, QByteArray> m_requestHeaders;
     QMultiMap<QByteArray, QByteArray> m_additionalResponseHeaders;
     ResourceRequestBody m_resourceRequestBody;
+    // Updated by the proxy on the handler's thread.
+    net::RequestPriority m_priority;
 };
 
 } // namespace
@@ -4,26 +4,70 @@
 #include "url_request_custom_job_proxy.h"
 #include "url_request_custom_job_delegate.h"
 
+#include "base/no_destructor.h"
+#include "base/task/thread_pool.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/net_errors.h"
 #include "services/network/public/cpp/resource_request_body.h"
 
 #include "api/qwebengineurlrequestjob.h"
+#include "api/qwebengineurlschemehandler_p.h"
 #include "profile_adapter.h"
 #include "type_conversion.h"
 #include "web_engine_context.h"
 
+#include <array>
+#include <map>
+
 namespace QtWebEngineCore {
 
+// Handlers in the ThreadPool threading mode run on a few dedicated threads per
+// priority, handed out in turn. Unlike a sequence, a single thread runner keeps
+// all tasks of a request, and the Qt objects created for it, on one thread.
+static scoped_refptr<base::SingleThreadTaskRunner> threadPoolTaskRunner(base::TaskPriority priority)
+{
+    DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+    static constexpr size_t kThreadsPerPriority = 4;
+    struct Threads
+    {
+        std::array<scoped_refptr<base::SingleThreadTaskRunner>, kThreadsPerPriority> runners;
+        size_t next = 0;
+    };
+    static base::NoDestructor<std::map<base::TaskPriority, Threads>> threadsByPriority;
+
+    Threads &threads = (*threadsByPriority)[priority];
+    scoped_refptr<base::SingleThreadTaskRunner> &runner = threads.runners[threads.next];
+    threads.next = (threads.next + 1) % kThreadsPerPriority;
+    if (!runner)
+        runner = base::ThreadPool::CreateSingleThreadTaskRunner(
+                { base::MayBlock(), priority }, base::SingleThreadTaskRunnerThreadMode::DEDICATED);
+    return runner;
+}
+
+static scoped_refptr<base::SingleThreadTaskRunner>
+createHandlerTaskRunner(bool threadPool, std::optional<base::TaskPriority> taskPriority)
+{
+    if (threadPool)
+        return threadPoolTaskRunner(taskPriority.value_or(base::TaskPriority::USER_BLOCKING));
+    if (taskPriority)
+        return content::GetUIThreadTaskRunner({ *taskPriority });
+    return content::GetUIThreadTaskRunner({});
+}
+
 URLRequestCustomJobProxy::URLRequestCustomJobProxy(URLRequestCustomJobProxy::Client *client,
                                                    const std::string &scheme,
-                                                   QPointer<ProfileAdapter> profileAdapter)
+                                                   QPointer<ProfileAdapter> profileAdapter,
+                                                   std::shared_ptr<UrlSchemeHandlerAccess> threadPoolAccess,
+                                                   std::optional<base::TaskPriority> handlerTaskPriority)
     : m_client(client)
     , m_started(false)
     , m_scheme(scheme)
     , m_delegate(nullptr)
     , m_profileAdapter(profileAdapter)
+    , m_threadPoolAccess(std::move(threadPoolAccess))
     , m_ioTaskRunner(m_client->taskRunner())
+    , m_handlerTaskRunner(createHandlerTaskRunner(m_threadPoolAccess != nullptr, handlerTaskPriority))
 {
     DCHECK(m_ioTaskRunner && m_ioTaskRunner->RunsTasksInCurrentSequence());
 }
@@ -34,19 +78,20 @@ URLRequestCustomJobProxy::~URLRequestCustomJobProxy()
 
 void URLRequestCustomJobProxy::release()
 {
-    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    DCHECK(m_handlerTaskRunner->RunsTasksInCurrentSequence());
     if (m_delegate) {
-        m_delegate->deleteLater();
+        // Worker threads have no Qt event loop to run a deferred delete, and the
+        // delegate was created on this thread.
+        if (m_threadPoolAccess)
+            delete m_delegate;
+        else
+            m_delegate->deleteLater();
         m_delegate = nullptr;
     }
 }
 
-void URLRequestCustomJobProxy::reply(std::string contentType, QIODevice *device,
-                                     QMultiMap<QByteArray, QByteArray> additionalResponseHeaders)
+void URLRequestCustomJobProxy::setContentType(std::string contentType)
 {
-    if (!m_client)
-        return;
-    DCHECK (!m_ioTaskRunner || m_ioTaskRunner->RunsTasksInCurrentSequence());
     QByteArray qcontentType = QByteArray::fromStdString(contentType).toLower();
     const int sidx = qcontentType.indexOf(';');
     if (sidx > 0) {
@@ -59,6 +104,15 @@ void URLRequestCustomJobProxy::reply(std::string contentType, QIODevice *device,
         }
     }
     m_client->m_mimeType = qcontentType.trimmed().toStdString();
+}
+
+void URLRequestCustomJobProxy::reply(std::string contentType, QIODevice *device,
+                                     QMultiMap<QByteArray, QByteArray> additionalResponseHeaders)
+{
+    if (!m_client)
+        return;
+    DCHECK (!m_ioTaskRunner || m_ioTaskRunner->RunsTasksInCurrentSequence());
+    setContentType(std::move(contentType));
     m_client->m_device = device;
     m_client->m_additionalResponseHeaders = std::move(additionalResponseHeaders);
     if (m_client->m_device && !m_client->m_device->isReadable())
@@ -79,6 +133,28 @@ void URLRequestCustomJobProxy::reply(std::string contentType, QIODevice *device,
     }
 }
 
+void URLRequestCustomJobProxy::replyWithData(std::string contentType, QByteArray data,
+                                             QMultiMap<QByteArray, QByteArray> additionalResponseHeaders)
+{
+    if (!m_client)
+        return;
+    DCHECK(m_ioTaskRunner->RunsTasksInCurrentSequence());
+    if (m_client->m_device || m_client->m_hasData || m_client->m_error)
+        return;
+    setContentType(std::move(contentType));
+    m_client->m_data = std::move(data);
+    m_client->m_hasData = true;
+    m_client->m_additionalResponseHeaders = std::move(additionalResponseHeaders);
+    if (!m_client->m_data.isEmpty())
+        m_client->notifyExpectedContentSize(m_client->m_data.size());
+
+    // notifyExpectedContentSize() completes the request if the range cannot be satisfied.
+    if (!m_client)
+        return;
+    m_started = true;
+    m_client->notifyHeadersComplete();
+}
+
 void URLRequestCustomJobProxy::redirect(GURL url)
 {
     if (!m_client)
@@ -130,30 +206,54 @@ void URLRequestCustomJobProxy::readyRead()
         m_client->notifyReadyRead();
 }
 
+void URLRequestCustomJobProxy::setPriority(net::RequestPriority priority)
+{
+    DCHECK(m_handlerTaskRunner->RunsTasksInCurrentSequence());
+    if (m_delegate)
+        m_delegate->m_priority = priority;
+}
+
 void URLRequestCustomJobProxy::initialize(GURL url, std::string method,
                                           std::optional<url::Origin> initiator,
                                           std::map<std::string, std::string> headers,
-                                          scoped_refptr<network::ResourceRequestBody> requestBody)
+                                          scoped_refptr<network::ResourceRequestBody> requestBody,
+                                          net::RequestPriority priority,
+                                          bool streamingRequestBody)
 {
-    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    DCHECK(m_handlerTaskRunner->RunsTasksInCurrentSequence());
     Q_ASSERT(!m_delegate);
 
     QUrl initiatorOrigin;
     if (initiator.has_value())
         initiatorOrigin = QUrl::fromEncoded(QByteArray::fromStdString(initiator.value().Serialize()));
 
-    QWebEngineUrlSchemeHandler *schemeHandler = nullptr;
-
-    if (m_profileAdapter)
-        schemeHandler = m_profileAdapter->urlSchemeHandler(toQByteArray(m_scheme));
     QMap<QByteArray, QByteArray> qHeaders;
     for (auto it = headers.cbegin(); it != headers.cend(); ++it)
         qHeaders.insert(toQByteArray(it->first), toQByteArray(it->second));
 
+    QWebEngineUrlSchemeHandler *schemeHandler = nullptr;
+    // Keeps the UI thread from removing a ThreadPool mode handler while it is called.
+    std::optional<QReadLocker> locker;
+    if (m_threadPoolAccess) {
+        locker.emplace(&m_threadPoolAccess->lock);
+        schemeHandler = m_threadPoolAccess->handler;
+        if (!schemeHandler) {
+            m_ioTaskRunner->PostTask(FROM_HERE, base::BindOnce(&URLRequestCustomJobProxy::fail, this,
+                                                               net::ERR_ABORTED));
+            return;
+        }
+    } else if (m_profileAdapter) {
+        schemeHandler = m_profileAdapter->urlSchemeHandler(toQByteArray(m_scheme));
+    }
+
     if (schemeHandler) {
         m_delegate =
                 new URLRequestCustomJobDelegate(this, toQt(url), QByteArray::fromStdString(method),
-                                                initiatorOrigin, qHeaders, requestBody.get());
+                                                initiatorOrigin, qHeaders, requestBody.get(),
+                                                streamingRequestBody
+                                                        ? ResourceRequestBody::ReadMode::Streaming
+                                                        : ResourceRequestBody::ReadMode::Blocking,
+                                                priority);
         QWebEngineUrlRequestJob *requestJob = new QWebEngineUrlRequestJob(m_delegate);
         schemeHandler->requestStarted(requestJob);
     }
@@ -5,12 +5,16 @@
 #define URL_REQUEST_CUSTOM_JOB_PROXY_H_
 
 #include "base/task/sequenced_task_runner.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/task/task_traits.h"
+#include "net/base/request_priority.h"
 #include "url/gurl.h"
 #include "url/origin.h"
 
 #include <QtCore/QPointer>
 #include <QMap>
 #include <QByteArray>
+#include <memory>
 #include <optional>
 
 QT_FORWARD_DECLARE_CLASS(QIODevice)
@@ -24,9 +28,11 @@ namespace QtWebEngineCore {
 class URLRequestCustomJob;
 class URLRequestCustomJobDelegate;
 class ProfileAdapter;
+struct UrlSchemeHandlerAccess;
 
 // Used to comunicate between URLRequestCustomJob living on the IO thread
-// and URLRequestCustomJobDelegate living on the UI thread.
+// and URLRequestCustomJobDelegate living on the UI thread, or on a dedicated
+// worker thread for handlers in the ThreadPool threading mode.
 class URLRequestCustomJobProxy : public base::RefCountedThreadSafe<URLRequestCustomJobProxy>
 {
 
@@ -38,6 +44,9 @@ public:
         QMultiMap<QByteArray, QByteArray> m_additionalResponseHeaders;
         GURL m_redirect;
         QIODevice *m_device;
+        // Replaces m_device when replying with in-memory data.
+        QByteArray m_data;
+        bool m_hasData;
         int64_t m_firstBytePosition;
         int m_error;
         virtual void notifyExpectedContentSize(qint64 size) = 0;
@@ -52,13 +61,17 @@ public:
 
     URLRequestCustomJobProxy(Client *client,
                              const std::string &scheme,
-                             QPointer<ProfileAdapter> profileAdapter);
+                             QPointer<ProfileAdapter> profileAdapter,
+                             std::shared_ptr<UrlSchemeHandlerAccess> threadPoolAccess = nullptr,
+                             std::optional<base::TaskPriority> handlerTaskPriority = std::nullopt);
     ~URLRequestCustomJobProxy();
 
     // Called from URLRequestCustomJobDelegate via post:
     //void setReplyCharset(const std::string &);
     void reply(std::string mimeType, QIODevice *device,
                QMultiMap<QByteArray, QByteArray> additionalResponseHeaders);
+    void replyWithData(std::string mimeType, QByteArray data,
+                       QMultiMap<QByteArray, QByteArray> additionalResponseHeaders);
     void redirect(GURL url);
     void abort();
     void fail(int error);
@@ -66,18 +79,30 @@ public:
     void release();
     void initialize(GURL url, std::string method, std::optional<url::Origin> initiatorOrigin,
                     std::map<std::string, std::string> headers,
-                    scoped_refptr<network::ResourceRequestBody> requestBody);
+                    scoped_refptr<network::ResourceRequestBody> requestBody,
+                    net::RequestPriority priority, bool streamingRequestBody);
+    void setPriority(net::RequestPriority priority);
     void readyRead();
 
+private:
+    void setContentType(std::string contentType);
+
+public:
     // IO thread owned:
     Client *m_client;
     bool m_started;
 
-    // UI thread owned:
+    // Handler thread owned, the UI thread or a worker thread:
     std::string m_scheme;
     URLRequestCustomJobDelegate *m_delegate;
     QPointer<ProfileAdapter> m_profileAdapter;
+    // Set for handlers in the ThreadPool threading mode.
+    const std::shared_ptr<UrlSchemeHandlerAccess> m_threadPoolAccess;
     scoped_refptr<base::SequencedTaskRunner> m_ioTaskRunner;
+    // Runs initialize(), setPriority() and release() on one thread, so that the
+    // Qt objects of the request are created and deleted there. Its task priority
+    // orders requests of handlers with prioritized scheduling.
+    scoped_refptr<base::SingleThreadTaskRunner> m_handlerTaskRunner;
 };
 
 } // namespace QtWebEngineCore
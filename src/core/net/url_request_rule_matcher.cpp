@@ -0,0 +1,273 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "url_request_rule_matcher.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace QtWebEngineCore {
+
+using Action = QWebEngineUrlRequestRule::Action;
+using Party = QWebEngineUrlRequestRule::Party;
+
+static char toLowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+static bool isSeparator(char c)
+{
+    return !((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-' || c == '.'
+             || c == '%');
+}
+
+// Matches |pattern| against the start of |text|, or anywhere in it with
+// |anywhere|. With |toEnd| the match has to extend to the end of |text|.
+static bool globMatch(std::string_view pattern, std::string_view text, bool anywhere, bool toEnd)
+{
+    size_t p = 0, t = 0;
+    bool backtrack = anywhere;
+    size_t restartP = 0, restartT = 0;
+    for (;;) {
+        if (p == pattern.size()) {
+            if (!toEnd || t == text.size())
+                return true;
+        } else if (pattern[p] == '*') {
+            backtrack = true;
+            restartP = ++p;
+            restartT = t;
+            continue;
+        } else if (t < text.size()
+                   && (pattern[p] == '^' ? isSeparator(text[t]) : pattern[p] == text[t])) {
+            ++p;
+            ++t;
+            continue;
+        } else if (pattern[p] == '^' && t == text.size()) {
+            ++p;
+            continue;
+        }
+        if (!backtrack || restartT >= text.size())
+            return false;
+        p = restartP;
+        t = ++restartT;
+    }
+}
+
+// The longest run of literal characters, which every match has to contain.
+static std::string_view keywordOf(std::string_view pattern)
+{
+    std::string_view best;
+    size_t start = 0;
+    for (size_t i = 0; i <= pattern.size(); ++i) {
+        if (i == pattern.size() || pattern[i] == '*' || pattern[i] == '^') {
+            if (i - start > best.size())
+                best = pattern.substr(start, i - start);
+            start = i + 1;
+        }
+    }
+    return best;
+}
+
+UrlRequestRuleMatcher::UrlRequestRuleMatcher(const QList<QWebEngineUrlRequestRule> &rules)
+    : m_rules(rules)
+{
+    m_nodes.emplace_back();
+    m_rootEdges.fill(0);
+    m_compiled.reserve(rules.size());
+    for (const QWebEngineUrlRequestRule &rule : rules) {
+        CompiledRule compiled;
+        std::string pattern = rule.urlPattern().toStdString();
+        std::transform(pattern.begin(), pattern.end(), pattern.begin(), toLowerAscii);
+        std::string_view body = pattern;
+        if (body.substr(0, 2) == "||") {
+            compiled.domainAnchor = true;
+            body.remove_prefix(2);
+        } else if (body.substr(0, 1) == "|") {
+            compiled.startAnchor = true;
+            body.remove_prefix(1);
+        }
+        if (!body.empty() && body.back() == '|') {
+            compiled.endAnchor = true;
+            body.remove_suffix(1);
+        }
+        compiled.pattern = std::string(body);
+        for (QWebEngineUrlRequestInfo::ResourceType type : rule.resourceTypes()) {
+            if (type >= 0 && type < 256)
+                compiled.resourceTypes.set(type);
+        }
+        compiled.party = rule.party();
+        compiled.action = rule.action();
+        compiled.redirectUrl = rule.redirectUrl().toString(QUrl::FullyEncoded).toStdString();
+        compiled.headerName = rule.headerName().toStdString();
+        compiled.headerValue = rule.headerValue().toStdString();
+        if ((compiled.action == Action::Redirect && compiled.redirectUrl.empty())
+            || ((compiled.action == Action::SetHeader || compiled.action == Action::RemoveHeader)
+                && compiled.headerName.empty())) {
+            qWarning("Ignoring URL request rule '%s' with incomplete action.",
+                     qPrintable(rule.urlPattern()));
+            continue;
+        }
+
+        const int index = int(m_compiled.size());
+        m_compiled.push_back(std::move(compiled));
+        const std::string_view keyword = keywordOf(m_compiled.back().pattern);
+        if (keyword.empty())
+            m_unindexed.push_back(index);
+        else
+            addKeyword(keyword, index);
+    }
+    buildFailLinks();
+}
+
+int UrlRequestRuleMatcher::child(int node, unsigned char c) const
+{
+    if (node == 0)
+        return m_rootEdges[c];
+    for (const auto &[edge, next] : m_nodes[node].children) {
+        if (edge == c)
+            return next;
+    }
+    return -1;
+}
+
+void UrlRequestRuleMatcher::addKeyword(std::string_view keyword, int rule)
+{
+    int node = 0;
+    for (char c : keyword) {
+        const unsigned char byte = c;
+        int next = child(node, byte);
+        if (next <= 0) {
+            next = int(m_nodes.size());
+            m_nodes.emplace_back();
+            m_nodes[node].children.emplace_back(byte, next);
+            if (node == 0)
+                m_rootEdges[byte] = next;
+        }
+        node = next;
+    }
+    m_nodes[node].rules.push_back(rule);
+}
+
+void UrlRequestRuleMatcher::buildFailLinks()
+{
+    std::queue<int> queue;
+    for (const auto &[edge, next] : m_nodes[0].children)
+        queue.push(next);
+    while (!queue.empty()) {
+        const int node = queue.front();
+        queue.pop();
+        for (const auto &[edge, next] : m_nodes[node].children) {
+            const int fail = transition(m_nodes[node].fail, edge);
+            m_nodes[next].fail = fail;
+            m_nodes[next].outputLink =
+                    m_nodes[fail].rules.empty() ? m_nodes[fail].outputLink : fail;
+            queue.push(next);
+        }
+    }
+}
+
+int UrlRequestRuleMatcher::transition(int node, unsigned char c) const
+{
+    for (;;) {
+        const int next = child(node, c);
+        if (next > 0)
+            return next;
+        if (node == 0)
+            return 0;
+        node = m_nodes[node].fail;
+    }
+}
+
+bool UrlRequestRuleMatcher::matches(const CompiledRule &rule, std::string_view url) const
+{
+    if (rule.startAnchor)
+        return globMatch(rule.pattern, url, false, rule.endAnchor);
+    if (!rule.domainAnchor)
+        return globMatch(rule.pattern, url, true, rule.endAnchor);
+
+    const size_t schemeEnd = url.find("://");
+    if (schemeEnd == std::string_view::npos)
+        return false;
+    const size_t hostBegin = schemeEnd + 3;
+    size_t hostEnd = url.find_first_of("/?#:", hostBegin);
+    if (hostEnd == std::string_view::npos)
+        hostEnd = url.size();
+    for (size_t start = hostBegin; start < hostEnd; ++start) {
+        if (start != hostBegin && url[start - 1] != '.')
+            continue;
+        if (globMatch(rule.pattern, url.substr(start), false, rule.endAnchor))
+            return true;
+    }
+    return false;
+}
+
+UrlRequestRuleMatcher::Result UrlRequestRuleMatcher::match(const Request &request) const
+{
+    Result result;
+    std::string url(request.url);
+    std::transform(url.begin(), url.end(), url.begin(), toLowerAscii);
+
+    std::vector<int> candidates = m_unindexed;
+    int node = 0;
+    for (char c : url) {
+        node = transition(node, c);
+        for (int output = m_nodes[node].rules.empty() ? m_nodes[node].outputLink : node;
+             output > 0; output = m_nodes[output].outputLink) {
+            candidates.insert(candidates.end(), m_nodes[output].rules.begin(),
+                              m_nodes[output].rules.end());
+        }
+    }
+    if (candidates.empty())
+        return result;
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    bool allowed = false;
+    const CompiledRule *redirect = nullptr;
+    std::vector<const CompiledRule *> headerRules;
+    for (int index : candidates) {
+        const CompiledRule &rule = m_compiled[index];
+        if (rule.resourceTypes.any()
+            && (request.resourceType < 0 || request.resourceType >= 256
+                || !rule.resourceTypes.test(request.resourceType)))
+            continue;
+        if ((rule.party == Party::FirstParty && request.thirdParty)
+            || (rule.party == Party::ThirdParty && !request.thirdParty))
+            continue;
+        if (!matches(rule, url))
+            continue;
+        switch (rule.action) {
+        case Action::Block:
+            result.block = true;
+            break;
+        case Action::Allow:
+            allowed = true;
+            break;
+        case Action::Redirect:
+            if (!redirect)
+                redirect = &rule;
+            break;
+        case Action::SetHeader:
+        case Action::RemoveHeader:
+            headerRules.push_back(&rule);
+            break;
+        }
+    }
+
+    if (allowed)
+        result.block = false;
+    else if (!result.block && redirect)
+        result.redirectUrl = redirect->redirectUrl;
+    if (result.block || result.redirectUrl)
+        return result;
+    for (const CompiledRule *rule : headerRules) {
+        if (rule->action == Action::SetHeader)
+            result.headers.emplace_back(rule->headerName, rule->headerValue);
+        else
+            result.headers.emplace_back(rule->headerName, std::nullopt);
+    }
+    return result;
+}
+
+} // namespace QtWebEngineCore
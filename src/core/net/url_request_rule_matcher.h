@@ -0,0 +1,90 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef URL_REQUEST_RULE_MATCHER_H
+#define URL_REQUEST_RULE_MATCHER_H
+
+#include <QtWebEngineCore/private/qtwebenginecoreglobal_p.h>
+#include <QtWebEngineCore/qwebengineurlrequestrule.h>
+
+#include <array>
+#include <bitset>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace QtWebEngineCore {
+
+// Compiled form of the QWebEngineUrlRequestRule list of a profile. The literal
+// keyword of every pattern goes into an Aho-Corasick automaton, so one pass
+// over a URL finds the few rules whose full pattern needs checking. Immutable
+// once built, and shared by the requests of the profile.
+class Q_WEBENGINECORE_EXPORT UrlRequestRuleMatcher
+{
+public:
+    struct Request
+    {
+        std::string_view url;
+        int resourceType;
+        bool thirdParty;
+    };
+
+    struct Result
+    {
+        bool block = false;
+        std::optional<std::string> redirectUrl;
+        // Header names and values to set, or to remove where there is no value.
+        std::vector<std::pair<std::string, std::optional<std::string>>> headers;
+    };
+
+    explicit UrlRequestRuleMatcher(const QList<QWebEngineUrlRequestRule> &rules);
+
+    const QList<QWebEngineUrlRequestRule> &rules() const { return m_rules; }
+    bool isEmpty() const { return m_compiled.empty(); }
+
+    Result match(const Request &request) const;
+
+private:
+    struct CompiledRule
+    {
+        std::string pattern; // lowercase, without anchors
+        bool domainAnchor = false;
+        bool startAnchor = false;
+        bool endAnchor = false;
+        std::bitset<256> resourceTypes; // none set means any
+        QWebEngineUrlRequestRule::Party party = QWebEngineUrlRequestRule::Party::Any;
+        QWebEngineUrlRequestRule::Action action = QWebEngineUrlRequestRule::Action::Block;
+        std::string redirectUrl;
+        std::string headerName;
+        std::string headerValue;
+    };
+
+    struct Node
+    {
+        std::vector<std::pair<unsigned char, int>> children;
+        int fail = 0;
+        // Next node along the fail links that ends a keyword, or -1.
+        int outputLink = -1;
+        std::vector<int> rules;
+    };
+
+    void addKeyword(std::string_view keyword, int rule);
+    void buildFailLinks();
+    int child(int node, unsigned char c) const;
+    int transition(int node, unsigned char c) const;
+    bool matches(const CompiledRule &rule, std::string_view url) const;
+
+    QList<QWebEngineUrlRequestRule> m_rules;
+    std::vector<CompiledRule> m_compiled;
+    std::vector<Node> m_nodes;
+    // Edges of the root, which has the most children, by byte.
+    std::array<int, 256> m_rootEdges;
+    // Rules without a literal keyword, checked for every request.
+    std::vector<int> m_unindexed;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // URL_REQUEST_RULE_MATCHER_H
@@ -0,0 +1,129 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "url_scheme_response_cache.h"
+
+namespace QtWebEngineCore {
+
+static QByteArray responseHeader(const QMultiMap<QByteArray, QByteArray> &headers,
+                                 QByteArrayView name)
+{
+    for (auto it = headers.cbegin(); it != headers.cend(); ++it) {
+        if (it.key().compare(name, Qt::CaseInsensitive) == 0)
+            return it.value().trimmed();
+    }
+    return QByteArray();
+}
+
+// Response header values reach the client lowercased, so the ETag it sends
+// back is compared case-insensitively, and weakly as If-None-Match requires.
+static QByteArray comparableETag(const QByteArray &etag)
+{
+    QByteArray result = etag.trimmed().toLower();
+    if (result.startsWith("w/"))
+        result.remove(0, 2);
+    return result;
+}
+
+UrlSchemeResponseCache::UrlSchemeResponseCache(qint64 maximumSize)
+    : m_entries(maximumSize)
+{
+}
+
+qint64 UrlSchemeResponseCache::maximumSize() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_entries.maxCost();
+}
+
+void UrlSchemeResponseCache::setMaximumSize(qint64 maximumSize)
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.setMaxCost(maximumSize);
+}
+
+void UrlSchemeResponseCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+}
+
+qint64 UrlSchemeResponseCache::maximumEntrySize() const
+{
+    return maximumSize() / 8;
+}
+
+std::optional<UrlSchemeResponseCache::Entry>
+UrlSchemeResponseCache::lookup(const QByteArray &url, const RequestHeaderLookup &requestHeader)
+{
+    QMutexLocker locker(&m_mutex);
+    const Entry *entry = m_entries.object(url);
+    if (!entry)
+        return std::nullopt;
+    if (entry->expiry.hasExpired()) {
+        m_entries.remove(url);
+        return std::nullopt;
+    }
+    for (const auto &[name, value] : entry->vary) {
+        if (requestHeader(name) != value)
+            return std::nullopt;
+    }
+    return *entry;
+}
+
+bool UrlSchemeResponseCache::matchesIfNoneMatch(const Entry &entry, const QByteArray &ifNoneMatch)
+{
+    if (entry.etag.isEmpty())
+        return false;
+    const QByteArray etag = comparableETag(entry.etag);
+    for (const QByteArray &candidate : ifNoneMatch.split(',')) {
+        const QByteArray comparable = comparableETag(candidate);
+        if (comparable == "*" || comparable == etag)
+            return true;
+    }
+    return false;
+}
+
+std::optional<UrlSchemeResponseCache::Entry>
+UrlSchemeResponseCache::cacheableEntry(const QMultiMap<QByteArray, QByteArray> &responseHeaders,
+                                       const RequestHeaderLookup &requestHeader)
+{
+    Entry entry;
+    const QByteArray cacheControl = responseHeader(responseHeaders, "cache-control").toLower();
+    for (const QByteArray &directive : cacheControl.split(',')) {
+        const QByteArray token = directive.trimmed();
+        if (token == "no-store" || token == "no-cache")
+            return std::nullopt;
+        if (token.startsWith("max-age=")) {
+            bool ok = false;
+            const qint64 maxAge = token.mid(8).toLongLong(&ok);
+            if (!ok || maxAge <= 0)
+                return std::nullopt;
+            entry.expiry = QDeadlineTimer(std::chrono::seconds(maxAge));
+        }
+    }
+
+    const QByteArray vary = responseHeader(responseHeaders, "vary").toLower();
+    for (const QByteArray &name : vary.split(',')) {
+        const QByteArray headerName = name.trimmed();
+        if (headerName.isEmpty())
+            continue;
+        if (headerName == "*")
+            return std::nullopt;
+        entry.vary.append({ headerName, requestHeader(headerName) });
+    }
+
+    entry.etag = responseHeader(responseHeaders, "etag");
+    entry.additionalResponseHeaders = responseHeaders;
+    return entry;
+}
+
+void UrlSchemeResponseCache::insert(const QByteArray &url, Entry entry)
+{
+    // Account for the headers too, so that empty bodies still have a cost.
+    const qint64 cost = entry.body.size() + url.size() + 1024;
+    QMutexLocker locker(&m_mutex);
+    m_entries.insert(url, new Entry(std::move(entry)), cost);
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef URL_SCHEME_RESPONSE_CACHE_H
+#define URL_SCHEME_RESPONSE_CACHE_H
+
+#include <QtWebEngineCore/private/qtwebenginecoreglobal_p.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmap.h>
+#include <QtCore/qmutex.h>
+
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace QtWebEngineCore {
+
+// In-memory cache of complete responses of a custom scheme handler, keyed by
+// URL and the request headers the response varies on. Used from the IO thread
+// by every loader of the scheme, and from the UI thread to resize or clear it.
+class Q_WEBENGINECORE_EXPORT UrlSchemeResponseCache
+{
+public:
+    struct Entry
+    {
+        std::string mimeType;
+        std::string charset;
+        QMultiMap<QByteArray, QByteArray> additionalResponseHeaders;
+        QByteArray body;
+        QByteArray etag;
+        // Lowercase header names and the request's values for them.
+        QList<std::pair<QByteArray, QByteArray>> vary;
+        QDeadlineTimer expiry{ QDeadlineTimer::Forever };
+    };
+    using RequestHeaderLookup = std::function<QByteArray(const QByteArray &name)>;
+
+    explicit UrlSchemeResponseCache(qint64 maximumSize);
+
+    qint64 maximumSize() const;
+    void setMaximumSize(qint64 maximumSize);
+    void clear();
+
+    // The largest body worth storing, so that one response cannot evict all others.
+    qint64 maximumEntrySize() const;
+
+    std::optional<Entry> lookup(const QByteArray &url, const RequestHeaderLookup &requestHeader);
+
+    // Whether an If-None-Match request header matches the ETag of the entry.
+    static bool matchesIfNoneMatch(const Entry &entry, const QByteArray &ifNoneMatch);
+
+    // Returns a partial entry with the headers filled in if the response
+    // headers allow storing it, with the body left for the caller to add.
+    static std::optional<Entry>
+    cacheableEntry(const QMultiMap<QByteArray, QByteArray> &responseHeaders,
+                   const RequestHeaderLookup &requestHeader);
+    void insert(const QByteArray &url, Entry entry);
+
+private:
+    mutable QMutex m_mutex;
+    QCache<QByteArray, Entry> m_entries;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // URL_SCHEME_RESPONSE_CACHE_H
@@ -20,10 +20,13 @@
 #include "url/url_util.h"
 
 #include "api/qwebengineurlscheme.h"
+#include "api/qwebengineurlschemehandler_p.h"
 #include "content_browser_client_qt.h"
 #include "download_manager_delegate_qt.h"
 #include "favicon_driver_qt.h"
 #include "favicon_service_factory_qt.h"
+#include "net/url_request_rule_matcher.h"
+#include "net/url_scheme_response_cache.h"
 #include "permission_manager_qt.h"
 #include "profile_adapter_client.h"
 #include "profile_io_data_qt.h"
@@ -57,6 +60,13 @@ inline QString buildLocationFromStandardPath(const QString &standardPath, const
 
 namespace QtWebEngineCore {
 
+// Waits for worker threads still calling a removed handler, so that it can be deleted.
+static void revokeThreadPoolAccess(QWebEngineUrlSchemeHandler *handler)
+{
+    if (handler)
+        QWebEngineUrlSchemeHandlerPrivate::get(handler)->revokeThreadPoolAccess();
+}
+
 ProfileAdapter::ProfileAdapter(const QString &storageName, const QString &dataPath,
                                const QString &cachePath, HttpCacheType httpCacheType,
                                PersistentCookiesPolicy persistentCookiesPolicy,
@@ -94,6 +104,8 @@ ProfileAdapter::ProfileAdapter(const QString &storageName, const QString &dataPa
 
 ProfileAdapter::~ProfileAdapter()
 {
+    for (const QPointer<QWebEngineUrlSchemeHandler> &handler : std::as_const(m_customUrlSchemeHandlers))
+        revokeThreadPoolAccess(handler);
     m_cancelableTaskTracker->TryCancelAll();
     m_profile->NotifyWillBeDestroyed();
     releaseAllWebContentsAdapterClients();
@@ -204,6 +216,31 @@ void ProfileAdapter::setRequestInterceptor(QWebEngineUrlRequestInterceptor *inte
     m_requestInterceptor = interceptor;
 }
 
+QWebEngineUrlResponseInterceptor *ProfileAdapter::responseInterceptor()
+{
+    return m_responseInterceptor.data();
+}
+
+void ProfileAdapter::setResponseInterceptor(QWebEngineUrlResponseInterceptor *interceptor)
+{
+    m_responseInterceptor = interceptor;
+}
+
+QList<QWebEngineUrlRequestRule> ProfileAdapter::urlRequestRules() const
+{
+    return m_urlRequestRuleMatcher ? m_urlRequestRuleMatcher->rules()
+                                   : QList<QWebEngineUrlRequestRule>();
+}
+
+void ProfileAdapter::setUrlRequestRules(const QList<QWebEngineUrlRequestRule> &rules)
+{
+    // Requests already in flight keep matching against the rules they started with.
+    if (rules.isEmpty())
+        m_urlRequestRuleMatcher.reset();
+    else
+        m_urlRequestRuleMatcher = std::make_shared<const UrlRequestRuleMatcher>(rules);
+}
+
 void ProfileAdapter::addClient(ProfileAdapterClient *adapterClient)
 {
     m_clients.append(adapterClient);
@@ -528,7 +565,9 @@ void ProfileAdapter::removeUrlSchemeHandler(QWebEngineUrlSchemeHandler *handler)
                 qWarning("Cannot remove the URL scheme handler for an internal scheme: %s", it.key().constData());
                 continue;
             }
+            m_urlSchemeResponseCaches.remove(it.key());
             it = m_customUrlSchemeHandlers.erase(it);
+            revokeThreadPoolAccess(handler);
             removedOneOrMore = true;
             continue;
         }
@@ -545,8 +584,14 @@ void ProfileAdapter::removeUrlScheme(const QByteArray &scheme)
         qWarning("Cannot remove the URL scheme handler for an internal scheme: %s", scheme.constData());
         return;
     }
-    if (m_customUrlSchemeHandlers.remove(canonicalScheme))
+    auto it = m_customUrlSchemeHandlers.find(canonicalScheme);
+    if (it != m_customUrlSchemeHandlers.end()) {
+        QWebEngineUrlSchemeHandler *handler = it->data();
+        m_customUrlSchemeHandlers.erase(it);
+        m_urlSchemeResponseCaches.remove(canonicalScheme);
+        revokeThreadPoolAccess(handler);
         updateCustomUrlSchemeHandlers();
+    }
 }
 
 void ProfileAdapter::installUrlSchemeHandler(const QByteArray &scheme, QWebEngineUrlSchemeHandler *handler)
@@ -570,18 +615,45 @@ void ProfileAdapter::installUrlSchemeHandler(const QByteArray &scheme, QWebEngin
                  "before installing the custom scheme handler.", scheme.constData());
 
     m_customUrlSchemeHandlers.insert(canonicalScheme, handler);
+    m_urlSchemeResponseCaches.remove(canonicalScheme);
     updateCustomUrlSchemeHandlers();
 }
 
 void ProfileAdapter::removeAllUrlSchemeHandlers()
 {
     if (m_customUrlSchemeHandlers.size() > 1) {
+        for (const QPointer<QWebEngineUrlSchemeHandler> &handler : std::as_const(m_customUrlSchemeHandlers)) {
+            if (handler != &m_qrcHandler)
+                revokeThreadPoolAccess(handler);
+        }
         m_customUrlSchemeHandlers.clear();
         m_customUrlSchemeHandlers.insert(QByteArrayLiteral("qrc"), &m_qrcHandler);
+        m_urlSchemeResponseCaches.clear();
         updateCustomUrlSchemeHandlers();
     }
 }
 
+// Each profile keeps its own responses, so that they are cleared along with
+// the profile's HTTP cache and never leak into other profiles.
+std::shared_ptr<UrlSchemeResponseCache> ProfileAdapter::urlSchemeResponseCache(const QByteArray &scheme)
+{
+    const QByteArray canonicalScheme = scheme.toLower();
+    QWebEngineUrlSchemeHandler *handler = urlSchemeHandler(canonicalScheme);
+    if (!handler) {
+        m_urlSchemeResponseCaches.remove(canonicalScheme);
+        return nullptr;
+    }
+    QWebEngineUrlSchemeHandlerPrivate *handlerPrivate = QWebEngineUrlSchemeHandlerPrivate::get(handler);
+    if (handlerPrivate->responseCacheSize <= 0) {
+        m_urlSchemeResponseCaches.remove(canonicalScheme);
+        return nullptr;
+    }
+    std::shared_ptr<UrlSchemeResponseCache> &cache = m_urlSchemeResponseCaches[canonicalScheme];
+    if (!cache)
+        cache = handlerPrivate->createResponseCache();
+    return cache;
+}
+
 UserResourceControllerHost *ProfileAdapter::userResourceController()
 {
     if (!m_userResourceController)
@@ -755,6 +827,8 @@ void ProfileAdapter::resetClientHints()
 
 void ProfileAdapter::clearHttpCache()
 {
+    for (const std::shared_ptr<UrlSchemeResponseCache> &cache : std::as_const(m_urlSchemeResponseCaches))
+        cache->clear();
     m_profile->m_profileIOData->clearHttpCache();
 }
 
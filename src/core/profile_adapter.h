@@ -24,9 +24,13 @@
 #include <QSharedPointer>
 #include <QString>
 
+#include <memory>
+
 #include <QtWebEngineCore/qwebengineclientcertificatestore.h>
 #include <QtWebEngineCore/qwebenginecookiestore.h>
 #include <QtWebEngineCore/qwebengineurlrequestinterceptor.h>
+#include <QtWebEngineCore/qwebengineurlrequestrule.h>
+#include <QtWebEngineCore/qwebengineurlresponseinterceptor.h>
 #include <QtWebEngineCore/qwebengineurlschemehandler.h>
 #include <QtWebEngineCore/qwebenginepermission.h>
 #include "net/qrc_url_scheme_handler.h"
@@ -47,6 +51,8 @@ class UserNotificationController;
 class DownloadManagerDelegateQt;
 class ProfileAdapterClient;
 class ProfileQt;
+class UrlRequestRuleMatcher;
+class UrlSchemeResponseCache;
 class UserResourceControllerHost;
 class VisitedLinksManagerQt;
 class WebContentsAdapterClient;
@@ -109,6 +115,15 @@ public:
     QWebEngineUrlRequestInterceptor* requestInterceptor();
     void setRequestInterceptor(QWebEngineUrlRequestInterceptor *interceptor);
 
+    QWebEngineUrlResponseInterceptor *responseInterceptor();
+    void setResponseInterceptor(QWebEngineUrlResponseInterceptor *interceptor);
+
+    QList<QWebEngineUrlRequestRule> urlRequestRules() const;
+    void setUrlRequestRules(const QList<QWebEngineUrlRequestRule> &rules);
+    // Null when there are no rules.
+    std::shared_ptr<const UrlRequestRuleMatcher> urlRequestRuleMatcher() const
+    { return m_urlRequestRuleMatcher; }
+
     QList<ProfileAdapterClient*> clients() { return m_clients; }
     void addClient(ProfileAdapterClient *adapterClient);
     void removeClient(ProfileAdapterClient *adapterClient);
@@ -178,6 +193,7 @@ public:
     void removeUrlScheme(const QByteArray &scheme);
     void removeUrlSchemeHandler(QWebEngineUrlSchemeHandler *handler);
     void removeAllUrlSchemeHandlers();
+    std::shared_ptr<UrlSchemeResponseCache> urlSchemeResponseCache(const QByteArray &scheme);
 
     const QList<QByteArray> customUrlSchemes() const;
     UserResourceControllerHost *userResourceController();
@@ -236,6 +252,8 @@ private:
     QWebEngineClientCertificateStore *m_clientCertificateStore = nullptr;
 #endif
     QPointer<QWebEngineUrlRequestInterceptor> m_requestInterceptor;
+    QPointer<QWebEngineUrlResponseInterceptor> m_responseInterceptor;
+    std::shared_ptr<const UrlRequestRuleMatcher> m_urlRequestRuleMatcher;
 
     QString m_dataPath;
     QString m_downloadPath;
@@ -247,6 +265,8 @@ private:
     PersistentPermissionsPolicy m_persistentPermissionsPolicy;
     VisitedLinksPolicy m_visitedLinksPolicy;
     QHash<QByteArray, QPointer<QWebEngineUrlSchemeHandler>> m_customUrlSchemeHandlers;
+    // Response caches of the installed scheme handlers that enabled one, by scheme.
+    QHash<QByteArray, std::shared_ptr<UrlSchemeResponseCache>> m_urlSchemeResponseCaches;
     QHash<QByteArray, QWeakPointer<UserNotificationController>> m_ephemeralNotifications;
     QHash<QByteArray, QSharedPointer<UserNotificationController>> m_persistentNotifications;
     bool m_clientHintsEnabled;
@@ -816,6 +816,24 @@ Compositor::Id RenderWidgetHostViewQt::compositorId()
     return m_uiCompositor->frame_sink_id();
 }
 
+// Limits the begin-frames of the display, and thereby of the renderers
+// embedded in it, to the given rate. A rate above the refresh rate of the
+// screen does not make frames faster. Zero restores the refresh rate.
+void RenderWidgetHostViewQt::setMaximumFrameRate(int framesPerSecond)
+{
+    if (m_maximumFrameRate == framesPerSecond)
+        return;
+    m_maximumFrameRate = framesPerSecond;
+
+    base::TimeDelta interval = viz::BeginFrameArgs::DefaultInterval();
+    QWindow *window = m_delegate->Window();
+    if (window && window->screen() && window->screen()->refreshRate() > 0)
+        interval = base::Hertz(window->screen()->refreshRate());
+    if (framesPerSecond > 0)
+        interval = std::max(interval, base::Hertz(framesPerSecond));
+    m_uiCompositor->SetDisplayVSyncParameters(base::TimeTicks(), interval);
+}
+
 void RenderWidgetHostViewQt::notifyShown()
 {
     // Handle possible frame eviction:
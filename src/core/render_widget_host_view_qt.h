@@ -172,6 +172,7 @@ public:
     // Called from WebContentsAdapter.
     gfx::SizeF lastContentsSize() const { return m_lastContentsSize; }
     gfx::PointF lastScrollOffset() const { return m_lastScrollOffset; }
+    void setMaximumFrameRate(int framesPerSecond);
 
     ui::TouchSelectionController *getTouchSelectionController() const { return m_touchSelectionController.get(); }
     TouchSelectionControllerClientQt *getTouchSelectionControllerClient() const { return m_touchSelectionControllerClient.get(); }
@@ -206,6 +207,7 @@ private:
 
     bool m_isMouseLocked = false;
     bool m_visible = false;
+    int m_maximumFrameRate = 0;
     bool m_deferredShow = false;
     gfx::PointF m_lastScrollOffset;
     gfx::SizeF m_lastContentsSize;
@@ -55,6 +55,9 @@ void RenderWidgetHostViewQtDelegateItem::initAsPopup(const QRect &screenRect)
 
 QRectF RenderWidgetHostViewQtDelegateItem::viewGeometry() const
 {
+    if (widgetPaintsContents())
+        return m_widgetDelegate->ViewGeometry();
+
     // Transform the entire rect to find the correct top left corner.
     const QPointF p1 = mapToGlobal(mapFromScene(QPointF(0, 0)));
     const QPointF p2 = mapToGlobal(mapFromScene(QPointF(width(), height())));
@@ -73,22 +76,33 @@ QRect RenderWidgetHostViewQtDelegateItem::windowGeometry() const
 
 void RenderWidgetHostViewQtDelegateItem::setKeyboardFocus()
 {
-    setFocus(true);
+    if (widgetPaintsContents())
+        m_widgetDelegate->SetKeyboardFocus();
+    else
+        setFocus(true);
 }
 
 bool RenderWidgetHostViewQtDelegateItem::hasKeyboardFocus()
 {
+    if (widgetPaintsContents())
+        return m_widgetDelegate->HasKeyboardFocus();
     return hasActiveFocus();
 }
 
 void RenderWidgetHostViewQtDelegateItem::lockMouse()
 {
-    grabMouse();
+    if (widgetPaintsContents())
+        m_widgetDelegate->LockMouse();
+    else
+        grabMouse();
 }
 
 void RenderWidgetHostViewQtDelegateItem::unlockMouse()
 {
-    ungrabMouse();
+    if (widgetPaintsContents())
+        m_widgetDelegate->UnlockMouse();
+    else
+        ungrabMouse();
 }
 
 void RenderWidgetHostViewQtDelegateItem::show()
@@ -124,7 +138,15 @@ QWindow *RenderWidgetHostViewQtDelegateItem::Window() const
 void RenderWidgetHostViewQtDelegateItem::readyToSwap()
 {
     // Call update() on UI thread.
-    QMetaObject::invokeMethod(this, &QQuickItem::update, Qt::QueuedConnection);
+    QMetaObject::invokeMethod(
+            this,
+            [this]() {
+                if (widgetPaintsContents())
+                    m_widgetDelegate->Update();
+                else
+                    update();
+            },
+            Qt::QueuedConnection);
 }
 
 void RenderWidgetHostViewQtDelegateItem::updateCursor(const QCursor &cursor)
@@ -364,6 +386,42 @@ void RenderWidgetHostViewQtDelegateItem::itemChange(ItemChange change, const Ite
     }
 }
 
+// Updates a node with an image node child per tile, reusing the children of oldNode in order.
+static QSGNode *updateTileNodes(QQuickWindow *win, QSGNode *oldNode,
+                                const QList<Compositor::TextureTile> &tiles, float devicePixelRatio)
+{
+    QSGNode *node = oldNode;
+    if (!node || node->type() != QSGNode::BasicNodeType) {
+        delete oldNode;
+        node = new QSGNode;
+    }
+
+    QSGNode *child = node->firstChild();
+    for (const Compositor::TextureTile &tile : tiles) {
+        QSGImageNode *imageNode = static_cast<QSGImageNode *>(child);
+        if (imageNode) {
+            child = child->nextSibling();
+        } else {
+            imageNode = win->createImageNode();
+            imageNode->setOwnsTexture(true);
+            node->appendChildNode(imageNode);
+        }
+        imageNode->setRect(QRectF(QPointF(tile.rect.topLeft()) / devicePixelRatio,
+                                  QSizeF(tile.rect.size()) / devicePixelRatio));
+        if (imageNode->texture() != tile.texture)
+            imageNode->setTexture(tile.texture);
+        else
+            imageNode->markDirty(QSGNode::DirtyMaterial);
+    }
+    while (child) {
+        QSGNode *next = child->nextSibling();
+        node->removeChildNode(child);
+        delete child;
+        child = next;
+    }
+    return node;
+}
+
 QSGNode *RenderWidgetHostViewQtDelegateItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
 {
     auto comp = compositor();
@@ -378,37 +436,54 @@ QSGNode *RenderWidgetHostViewQtDelegateItem::updatePaintNode(QSGNode *oldNode, U
 
     QQuickWindow *win = QQuickItem::window();
 
-    QSGImageNode *node = nullptr;
     // Delete old node before swapFrame to decrement refcount of
-    // QImage in software mode.
-    if (comp->type() == Compositor::Type::Software)
+    // QImage in software mode, unless the texture is updated in place.
+    const bool persistentTexture = comp->textureIsPersistent(win);
+    if (comp->type() == Compositor::Type::Software && !persistentTexture) {
         delete oldNode;
+        oldNode = nullptr;
+    }
+
+    comp->swapFrame();
+
+    QQuickWindow::CreateTextureOptions texOpts;
+    if (comp->requiresAlphaChannel() || m_clearColor.alpha() < 255)
+        texOpts.setFlag(QQuickWindow::TextureHasAlphaChannel);
     else
+        texOpts.setFlag(QQuickWindow::TextureIsOpaque);
+
+    const QList<Compositor::TextureTile> tiles = comp->textureTiles(win, texOpts);
+    if (!tiles.isEmpty())
+        return updateTileNodes(win, oldNode, tiles, comp->devicePixelRatio());
+
+    QSGImageNode *node = nullptr;
+    if (oldNode && oldNode->type() != QSGNode::GeometryNodeType) {
+        // Tiles of a previous frame.
+        delete oldNode;
+        oldNode = nullptr;
+    } else {
         node = static_cast<QSGImageNode*>(oldNode);
+    }
 
     if (!node) {
         node = win->createImageNode();
         node->setOwnsTexture(true);
     }
 
-    comp->swapFrame();
-
     QSize texSize = comp->size();
     QSizeF texSizeInDips = QSizeF(texSize) / comp->devicePixelRatio();
     node->setRect(QRectF(QPointF(0, 0), texSizeInDips));
 
-    QQuickWindow::CreateTextureOptions texOpts;
-    if (comp->requiresAlphaChannel() || m_clearColor.alpha() < 255)
-        texOpts.setFlag(QQuickWindow::TextureHasAlphaChannel);
-    else
-        texOpts.setFlag(QQuickWindow::TextureIsOpaque);
     QSGTexture *texture = comp->texture(win, texOpts);
     if (texture) {
-        node->setTexture(texture);
+        if (node->texture() != texture)
+            node->setTexture(texture);
+        else
+            node->markDirty(QSGNode::DirtyMaterial);
         if (comp->textureIsFlipped())
             node->setTextureCoordinatesTransform(QSGImageNode::MirrorVertically);
     } else {
-        if (!oldNode || comp->type() == Compositor::Type::Software) {
+        if (!oldNode || (comp->type() == Compositor::Type::Software && !persistentTexture)) {
             qDebug("Compositor returned null texture");
             delete node;
             return nullptr;
@@ -18,7 +18,9 @@ namespace QtWebEngineCore {
 
 class RenderWidgetHostViewQtDelegateClient;
 class WebContentsAdapterClient;
-class WebEngineQuickWidget;
+class WebEngineRasterWidget;
+template<typename Base>
+class WebEngineDelegateWidgetBase;
 
 class WidgetDelegate
 {
@@ -37,6 +39,17 @@ public:
     virtual QWindow *Window() { return nullptr; }
     virtual void SetCursor(const QCursor &) { }
     virtual void unhandledWheelEvent(QWheelEvent *) { }
+
+    // Whether the delegate paints the frames itself, in which case the item
+    // is not shown in a QQuickWindow and the methods below are used instead
+    // of their QQuickItem counterparts.
+    virtual bool PaintsContents() { return false; }
+    virtual void Update() { }
+    virtual QRectF ViewGeometry() { return QRectF(); }
+    virtual void SetKeyboardFocus() { }
+    virtual bool HasKeyboardFocus() { return false; }
+    virtual void LockMouse() { }
+    virtual void UnlockMouse() { }
 };
 
 // Useful information keyboard and mouse QEvent propagation.
@@ -110,7 +123,11 @@ private Q_SLOTS:
 private:
     friend QWebEngineViewPrivate;
     friend QQuickWebEngineViewPrivate;
-    friend WebEngineQuickWidget;
+    template<typename Base>
+    friend class WebEngineDelegateWidgetBase;
+    friend WebEngineRasterWidget;
+
+    bool widgetPaintsContents() const { return m_widgetDelegate && m_widgetDelegate->PaintsContents(); }
 
     RenderWidgetHostViewQtDelegateClient *m_client;
     bool m_isPopup;
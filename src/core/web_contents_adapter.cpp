@@ -8,6 +8,7 @@
 #include "web_contents_adapter.h"
 
 #include "autofill_client_qt.h"
+#include "compositor/compositor_frame_capture.h"
 #include "content_browser_client_qt.h"
 #include "devtools_frontend_qt.h"
 #include "download_manager_delegate_qt.h"
@@ -15,6 +16,7 @@
 #include "favicon_service_factory_qt.h"
 #include "find_text_helper.h"
 #include "media_capture_devices_dispatcher.h"
+#include "net/network_request_log.h"
 #include "pdf_util_qt.h"
 #include "profile_adapter.h"
 #include "profile_qt.h"
@@ -1415,6 +1417,84 @@ QSizeF WebContentsAdapter::lastContentsSize() const
     return QSizeF();
 }
 
+FrameStatistics WebContentsAdapter::frameStatistics() const
+{
+    CHECK_INITIALIZED(FrameStatistics());
+    if (RenderWidgetHostViewQt *rwhv = static_cast<RenderWidgetHostViewQt *>(m_webContents->GetRenderWidgetHostView())) {
+        if (auto compositor = Compositor::find(rwhv->compositorId()))
+            return compositor->frameStatistics();
+    }
+    return FrameStatistics();
+}
+
+void WebContentsAdapter::resetFrameStatistics()
+{
+    CHECK_INITIALIZED();
+    if (RenderWidgetHostViewQt *rwhv = static_cast<RenderWidgetHostViewQt *>(m_webContents->GetRenderWidgetHostView())) {
+        if (auto compositor = Compositor::find(rwhv->compositorId()))
+            compositor->resetFrameStatistics();
+    }
+}
+
+void WebContentsAdapter::startFrameCapture(qreal maximumFrameRate,
+                                           std::function<void(const QImage &, const QRegion &, qint64)> &&callback)
+{
+    m_frameCapture.reset(new CompositorFrameCapture(std::move(callback)));
+    m_frameCapture->setMaximumFrameRate(maximumFrameRate);
+    if (!isInitialized())
+        return;
+    if (auto *rwhv = static_cast<RenderWidgetHostViewQt *>(m_webContents->GetRenderWidgetHostView()))
+        m_frameCapture->attach(rwhv->compositorId());
+}
+
+void WebContentsAdapter::stopFrameCapture()
+{
+    m_frameCapture.reset();
+}
+
+void WebContentsAdapter::startNetworkRequestLog(
+        std::function<void(const QList<NetworkRequestEntry> &)> &&callback)
+{
+    if (m_networkRequestLog)
+        m_networkRequestLog->flush();
+    m_networkRequestLog.reset(new NetworkRequestLog(std::move(callback)));
+}
+
+void WebContentsAdapter::stopNetworkRequestLog()
+{
+    if (!m_networkRequestLog)
+        return;
+    // Deliver what was already collected rather than losing it.
+    std::unique_ptr<NetworkRequestLog> log = std::move(m_networkRequestLog);
+    log->flush();
+}
+
+void WebContentsAdapter::setMaximumFrameRate(int framesPerSecond)
+{
+    m_maximumFrameRate = qMax(framesPerSecond, 0);
+    if (!isInitialized())
+        return;
+    if (auto *rwhv = static_cast<RenderWidgetHostViewQt *>(m_webContents->GetRenderWidgetHostView()))
+        rwhv->setMaximumFrameRate(m_maximumFrameRate);
+}
+
+// Applies per-view state to the current render widget host view.
+void WebContentsAdapter::renderWidgetHostViewChanged()
+{
+    if (!isInitialized())
+        return;
+    RenderWidgetHostViewQt *rwhv = static_cast<RenderWidgetHostViewQt *>(m_webContents->GetRenderWidgetHostView());
+    if (m_frameCapture) {
+        if (rwhv)
+            m_frameCapture->attach(rwhv->compositorId());
+        else
+            m_frameCapture->detach();
+    }
+    // Views follow the refresh rate of their screen unless a rate was set.
+    if (rwhv && m_maximumFrameRate > 0)
+        rwhv->setMaximumFrameRate(m_maximumFrameRate);
+}
+
 void WebContentsAdapter::setPermission(const QUrl &origin, QWebEnginePermission::PermissionType permissionType, QWebEnginePermission::State state)
 {
     if (QWebEnginePermission::isPersistent(permissionType)) {
@@ -55,9 +55,11 @@ class QAccessibleInterface;
 class QDragEnterEvent;
 class QDragMoveEvent;
 class QDropEvent;
+class QImage;
 class QMimeData;
 class QPageLayout;
 class QPageRanges;
+class QRegion;
 class QTemporaryDir;
 class QWebChannel;
 class QWebEngineUrlRequestInterceptor;
@@ -65,8 +67,12 @@ QT_END_NAMESPACE
 
 namespace QtWebEngineCore {
 
+class CompositorFrameCapture;
 class DevToolsFrontendQt;
 class FindTextHelper;
+struct FrameStatistics;
+struct NetworkRequestEntry;
+class NetworkRequestLog;
 class ProfileQt;
 class WebEnginePageHost;
 class WebChannelIPCTransportHost;
@@ -200,6 +206,23 @@ public:
     QPointF lastScrollOffset() const;
     QSizeF lastContentsSize() const;
 
+    FrameStatistics frameStatistics() const;
+    void resetFrameStatistics();
+
+    void startFrameCapture(qreal maximumFrameRate,
+                           std::function<void(const QImage &, const QRegion &, qint64)> &&callback);
+    void stopFrameCapture();
+
+    void startNetworkRequestLog(std::function<void(const QList<NetworkRequestEntry> &)> &&callback);
+    void stopNetworkRequestLog();
+    // Null unless the log was started.
+    NetworkRequestLog *networkRequestLog() const { return m_networkRequestLog.get(); }
+
+    int maximumFrameRate() const { return m_maximumFrameRate; }
+    void setMaximumFrameRate(int framesPerSecond);
+
+    void renderWidgetHostViewChanged();
+
 #if QT_CONFIG(draganddrop)
     void startDragging(QObject *dragSource, const content::DropData &dropData,
                        Qt::DropActions allowedActions, const QPixmap &pixmap, const QPoint &offset);
@@ -287,6 +310,9 @@ private:
     bool m_inspector = false;
     bool m_documentIsHandlingDrag = false;
     QPointer<QWebEngineUrlRequestInterceptor> m_requestInterceptor;
+    std::unique_ptr<CompositorFrameCapture> m_frameCapture;
+    std::unique_ptr<NetworkRequestLog> m_networkRequestLog;
+    int m_maximumFrameRate = 0;
 };
 
 } // namespace QtWebEngineCore
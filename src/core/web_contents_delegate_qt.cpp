@@ -320,6 +320,7 @@ void WebContentsDelegateQt::RenderViewHostChanged(content::RenderViewHost *, con
         Q_ASSERT(rwhv->delegate());
         rwhv->delegate()->adapterClientChanged(m_viewClient);
         m_viewClient->zoomUpdateIsNeeded();
+        m_viewClient->webContentsAdapter()->renderWidgetHostViewChanged();
         auto backgroundColor = m_viewClient->backgroundColor();
         if (backgroundColor != Qt::white)
             m_viewClient->webContentsAdapter()->setBackgroundColor(backgroundColor);
@@ -334,6 +335,7 @@ void WebContentsDelegateQt::RenderViewReady()
         auto *rwhv = static_cast<RenderWidgetHostViewQt *>(newHostView);
         Q_ASSERT(rwhv->delegate());
         rwhv->delegate()->updateAdapterClientIfNeeded(m_viewClient);
+        m_viewClient->webContentsAdapter()->renderWidgetHostViewChanged();
     }
 }
 
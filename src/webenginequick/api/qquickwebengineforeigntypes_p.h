@@ -27,6 +27,7 @@
 #include <QtWebEngineCore/qwebenginenotification.h>
 #include <QtWebEngineCore/qwebenginefindtextresult.h>
 #include <QtWebEngineCore/qwebenginecertificateerror.h>
+#include <QtWebEngineCore/qwebenginecompositorstatistics.h>
 #include <QtWebEngineCore/qwebenginefullscreenrequest.h>
 #include <QtWebEngineCore/qwebenginecontextmenurequest.h>
 #include <QtWebEngineCore/qwebengineregisterprotocolhandlerrequest.h>
@@ -265,6 +266,15 @@ struct ForeignWebEnginePermission
     QML_UNCREATABLE("")
 };
 
+struct ForeignWebEngineCompositorStatistics
+{
+    Q_GADGET
+    QML_FOREIGN(QWebEngineCompositorStatistics)
+    QML_VALUE_TYPE(webEngineCompositorStatistics)
+    QML_ADDED_IN_VERSION(6, 10)
+    QML_UNCREATABLE("")
+};
+
 QT_END_NAMESPACE
 
 #endif // QQUICKWEBENGINEFOREIGNTYPES_H
@@ -179,6 +179,7 @@ QQuickWebEngineProfilePrivate::~QQuickWebEngineProfilePrivate()
         // In the case the user sets this profile as the parent of the interceptor
         // it can be deleted before the browser-context still referencing it is.
         m_profileAdapter->setRequestInterceptor(nullptr);
+        m_profileAdapter->setResponseInterceptor(nullptr);
         m_profileAdapter->removeClient(this);
     }
 
@@ -1041,6 +1041,9 @@ void QQuickWebEngineViewPrivate::initializationFinished()
     if (m_defaultAudioMuted != adapter->isAudioMuted())
         adapter->setAudioMuted(m_defaultAudioMuted);
 
+    if (m_maximumFrameRate != adapter->maximumFrameRate())
+        adapter->setMaximumFrameRate(m_maximumFrameRate);
+
     if (devToolsView && devToolsView->d_ptr->adapter)
         adapter->openDevToolsFrontend(devToolsView->d_ptr->adapter);
 
@@ -1625,6 +1628,23 @@ void QQuickWebEngineView::setAudioMuted(bool muted)
         Q_EMIT audioMutedChanged(muted);
 }
 
+int QQuickWebEngineView::maximumFrameRate() const
+{
+    const Q_D(QQuickWebEngineView);
+    return d->m_maximumFrameRate;
+}
+
+void QQuickWebEngineView::setMaximumFrameRate(int framesPerSecond)
+{
+    Q_D(QQuickWebEngineView);
+    framesPerSecond = qMax(framesPerSecond, 0);
+    if (d->m_maximumFrameRate == framesPerSecond)
+        return;
+    d->m_maximumFrameRate = framesPerSecond;
+    d->adapter->setMaximumFrameRate(framesPerSecond);
+    Q_EMIT maximumFrameRateChanged(framesPerSecond);
+}
+
 bool QQuickWebEngineView::recentlyAudible() const
 {
     const Q_D(QQuickWebEngineView);
@@ -2608,6 +2628,18 @@ QWebEngineFrame QQuickWebEngineView::findFrameByName(const QString &name)
     return QWebEngineFrame(d->adapter, maybeId.value_or(WebContentsAdapter::kInvalidFrameId));
 }
 
+QWebEngineCompositorStatistics QQuickWebEngineView::compositorStatistics() const
+{
+    Q_D(const QQuickWebEngineView);
+    return QWebEngineCompositorStatistics(d->adapter->frameStatistics());
+}
+
+void QQuickWebEngineView::resetCompositorStatistics()
+{
+    Q_D(QQuickWebEngineView);
+    d->adapter->resetFrameStatistics();
+}
+
 void QQuickWebEngineView::save(const QString &filePath,
                                QWebEngineDownloadRequest::SavePageFormat format) const
 {
@@ -16,6 +16,7 @@
 //
 
 #include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebenginecompositorstatistics.h>
 #include <QtWebEngineCore/qwebenginequotarequest.h>
 #include <QtWebEngineCore/qwebenginedesktopmediarequest.h>
 #include <QtWebEngineCore/qwebenginedownloadrequest.h>
@@ -94,6 +95,7 @@ class Q_WEBENGINEQUICK_EXPORT QQuickWebEngineView : public QQuickItem {
     Q_PROPERTY(QQmlComponent *touchHandleDelegate READ touchHandleDelegate WRITE
                        setTouchHandleDelegate NOTIFY touchHandleDelegateChanged REVISION(0) FINAL)
     Q_PROPERTY(QWebEngineFrame mainFrame READ mainFrame FINAL REVISION(6, 8))
+    Q_PROPERTY(int maximumFrameRate READ maximumFrameRate WRITE setMaximumFrameRate NOTIFY maximumFrameRateChanged FINAL REVISION(6, 10))
     QML_NAMED_ELEMENT(WebEngineView)
     QML_ADDED_IN_VERSION(1, 0)
     QML_EXTRA_VERSION(2, 0)
@@ -456,6 +458,8 @@ QT_WARNING_POP
 
     bool isAudioMuted() const;
     void setAudioMuted(bool muted);
+    int maximumFrameRate() const;
+    void setMaximumFrameRate(int framesPerSecond);
     bool recentlyAudible() const;
 
     qint64 renderProcessPid() const;
@@ -479,6 +483,9 @@ QT_WARNING_POP
     QWebEngineFrame mainFrame();
     Q_REVISION(6, 8) Q_INVOKABLE QWebEngineFrame findFrameByName(const QString &name);
 
+    Q_REVISION(6, 10) Q_INVOKABLE QWebEngineCompositorStatistics compositorStatistics() const;
+    Q_REVISION(6, 10) Q_INVOKABLE void resetCompositorStatistics();
+
 public Q_SLOTS:
     void runJavaScript(const QString&, const QJSValue & = QJSValue());
     Q_REVISION(1,3) void runJavaScript(const QString&, quint32 worldId, const QJSValue & = QJSValue());
@@ -573,6 +580,7 @@ Q_SIGNALS:
     Q_REVISION(6,7) void desktopMediaRequested(const QWebEngineDesktopMediaRequest &request);
     Q_REVISION(6, 8) void printRequestedByFrame(QWebEngineFrame frame);
     Q_REVISION(6,8) void permissionRequested(QWebEnginePermission permissionRequest);
+    Q_REVISION(6, 10) void maximumFrameRateChanged(int framesPerSecond);
 
 protected:
     void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
@@ -169,6 +169,7 @@ public:
     QPointer<QQuickWebEngineView> devToolsView;
     uint m_webChannelWorld;
     bool m_defaultAudioMuted;
+    int m_maximumFrameRate = 0;
     bool m_isBeingAdopted;
     mutable QQuickWebEngineAction *actions[QQuickWebEngineView::WebActionCount];
     QtWebEngineCore::RenderWidgetHostViewQtDelegateItem *delegateItem = nullptr;
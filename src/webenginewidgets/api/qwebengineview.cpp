@@ -29,7 +29,9 @@
 #include <QIcon>
 #include <QStyle>
 #include <QGuiApplication>
+#include <QPainter>
 #include <QQuickWidget>
+#include <QQuickWindow>
 #include <QtWidgets/private/qapplication_p.h>
 
 #if QT_CONFIG(accessibility)
@@ -79,45 +81,50 @@ public:
 QT_END_NAMESPACE
 
 namespace QtWebEngineCore {
-class WebEngineQuickWidget : public QQuickWidget, public WidgetDelegate
+
+// Widget hosting a RenderWidgetHostViewQtDelegateItem in a QWebEngineView.
+class WebEngineDelegateWidget : public WidgetDelegate
 {
 public:
-    WebEngineQuickWidget(RenderWidgetHostViewQtDelegateItem *widget, QWidget *parent)
-        : QQuickWidget(parent)
-        , m_contentItem(widget)
-    {
-        setFocusPolicy(Qt::StrongFocus);
-        setMouseTracking(true);
-        setAttribute(Qt::WA_AcceptTouchEvents);
-        setAttribute(Qt::WA_OpaquePaintEvent);
-        setAttribute(Qt::WA_AlwaysShowToolTips);
+    virtual QWidget *widget() = 0;
 
-        QQuickItem *root = new QQuickItem(); // Indirection so we don't delete m_contentItem
-        setContent(QUrl(), nullptr, root);
-        root->setFlags(QQuickItem::ItemHasContents);
-        root->setVisible(true);
-        m_contentItem->setParentItem(root);
+protected:
+    WebEngineDelegateWidget(RenderWidgetHostViewQtDelegateItem *item) : m_contentItem(item) { }
 
-        connectRemoveParentBeforeParentDelete();
-    }
-    ~WebEngineQuickWidget() override
+    friend QWebEngineViewPrivate;
+    QPointer<RenderWidgetHostViewQtDelegateItem> m_contentItem; // deleted by core
+};
+
+// Behavior shared by the QWidget based delegate widgets.
+template<typename Base>
+class WebEngineDelegateWidgetBase : public Base, public WebEngineDelegateWidget
+{
+public:
+    WebEngineDelegateWidgetBase(RenderWidgetHostViewQtDelegateItem *item, QWidget *parent)
+        : Base(parent)
+        , WebEngineDelegateWidget(item)
     {
-        if (m_contentItem) {
-            m_contentItem->setWidgetDelegate(nullptr);
-            m_contentItem->setParentItem(nullptr);
-        }
+        this->setFocusPolicy(Qt::StrongFocus);
+        this->setMouseTracking(true);
+        this->setAttribute(Qt::WA_AcceptTouchEvents);
+        this->setAttribute(Qt::WA_OpaquePaintEvent);
+        this->setAttribute(Qt::WA_AlwaysShowToolTips);
+
+        connectRemoveParentBeforeParentDelete();
     }
 
+    QWidget *widget() override { return this; }
+
     void InitAsPopup(const QRect &screenRect) override
     {
-        setAttribute(Qt::WA_ShowWithoutActivating);
-        setFocusPolicy(Qt::NoFocus);
-        setWindowFlags(Qt::Popup | Qt::FramelessWindowHint | Qt::WindowDoesNotAcceptFocus);
+        this->setAttribute(Qt::WA_ShowWithoutActivating);
+        this->setFocusPolicy(Qt::NoFocus);
+        this->setWindowFlags(Qt::Popup | Qt::FramelessWindowHint | Qt::WindowDoesNotAcceptFocus);
 
-        setGeometry(screenRect);
-        raise();
+        this->setGeometry(screenRect);
+        this->raise();
         m_contentItem->show();
-        show();
+        this->show();
     }
 
     void Bind(WebContentsAdapterClient *client) override
@@ -126,7 +133,7 @@ public:
         if (m_pageDestroyedConnection)
             QObject::disconnect(m_pageDestroyedConnection);
         QWebEngineViewPrivate::bindPageAndWidget(page, this);
-        m_pageDestroyedConnection = QObject::connect(page->q_ptr, &QObject::destroyed, this, &WebEngineQuickWidget::Unbind);
+        m_pageDestroyedConnection = QObject::connect(page->q_ptr, &QObject::destroyed, this, &WebEngineDelegateWidgetBase::Unbind);
     }
 
     void Unbind() override
@@ -140,7 +147,7 @@ public:
 
     void Destroy() override
     {
-        deleteLater();
+        this->deleteLater();
 
         // The event loop may be exited at this point.
         // Ensure deferred deletion in this scenario.
@@ -155,43 +162,29 @@ public:
 
     void SetInputMethodEnabled(bool enabled) override
     {
-        QQuickWidget::setAttribute(Qt::WA_InputMethodEnabled, enabled);
+        Base::setAttribute(Qt::WA_InputMethodEnabled, enabled);
     }
     void SetInputMethodHints(Qt::InputMethodHints hints) override
     {
-        QQuickWidget::setInputMethodHints(hints);
-    }
-    void SetClearColor(const QColor &color) override
-    {
-        setUpdatesEnabled(false);
-        QQuickWidget::setClearColor(color);
-        // QQuickWidget is usually blended by punching holes into widgets
-        // above it to simulate the visual stacking order. If we want it to be
-        // transparent we have to throw away the proper stacking order and always
-        // blend the complete normal widgets backing store under it.
-        bool isTranslucent = color.alpha() < 255;
-        setAttribute(Qt::WA_AlwaysStackOnTop, isTranslucent);
-        setAttribute(Qt::WA_OpaquePaintEvent, !isTranslucent);
-        setUpdatesEnabled(true);
-        window()->update();
+        Base::setInputMethodHints(hints);
     }
     void MoveWindow(const QPoint &screenPos) override
     {
-        QQuickWidget::move(screenPos);
+        Base::move(screenPos);
     }
     void Resize(int width, int height) override
     {
-        QQuickWidget::resize(width, height);
+        Base::resize(width, height);
     }
     QWindow *Window() override
     {
-        if (const QWidget *root = QQuickWidget::window())
+        if (const QWidget *root = Base::window())
             return root->windowHandle();
         return nullptr;
     }
     void unhandledWheelEvent(QWheelEvent *ev) override
     {
-        auto parentWidget = QQuickWidget::parentWidget();
+        auto parentWidget = Base::parentWidget();
         if (parentWidget) {
             if (QApplicationPrivate::wheel_widget)
                 QApplicationPrivate::wheel_widget = nullptr;
@@ -201,14 +194,14 @@ public:
     }
     void SetCursor(const QCursor &cursor) override
     {
-        if (auto parentWidget = QQuickWidget::parentWidget())
+        if (auto parentWidget = Base::parentWidget())
             parentWidget->setCursor(cursor);
     }
 
 protected:
     void closeEvent(QCloseEvent *event) override
     {
-        QQuickWidget::closeEvent(event);
+        Base::closeEvent(event);
 
         // If a close event was received from the window manager (e.g. when moving the parent window,
         // clicking outside the popup area)
@@ -219,21 +212,21 @@ protected:
     }
     void showEvent(QShowEvent *event) override
     {
-        QQuickWidget::showEvent(event);
+        Base::showEvent(event);
         // We don't have a way to catch a top-level window change with QWidget
         // but a widget will most likely be shown again if it changes, so do
         // the reconnection at this point.
         for (const QMetaObject::Connection &c : std::as_const(m_windowConnections))
-            disconnect(c);
+            QObject::disconnect(c);
         m_windowConnections.clear();
         if (QWindow *w = Window()) {
-            m_windowConnections.append(connect(w, SIGNAL(xChanged(int)), m_contentItem, SLOT(onWindowPosChanged())));
-            m_windowConnections.append(connect(w, SIGNAL(yChanged(int)), m_contentItem, SLOT(onWindowPosChanged())));
+            m_windowConnections.append(QObject::connect(w, SIGNAL(xChanged(int)), m_contentItem, SLOT(onWindowPosChanged())));
+            m_windowConnections.append(QObject::connect(w, SIGNAL(yChanged(int)), m_contentItem, SLOT(onWindowPosChanged())));
         }
     }
     void resizeEvent(QResizeEvent *event) override
     {
-        QQuickWidget::resizeEvent(event);
+        Base::resizeEvent(event);
         if (m_contentItem) { // FIXME: Not sure why we need to set m_contentItem size manually
             m_contentItem->setSize(event->size());
             m_contentItem->onWindowPosChanged();
@@ -251,39 +244,40 @@ protected:
     void removeParentBeforeParentDelete();
 
 private:
-    friend QWebEngineViewPrivate;
-    QPointer<RenderWidgetHostViewQtDelegateItem> m_contentItem; // deleted by core
     QMetaObject::Connection m_parentDestroyedConnection;
     QMetaObject::Connection m_pageDestroyedConnection;
     QList<QMetaObject::Connection> m_windowConnections;
 };
 
-void WebEngineQuickWidget::connectRemoveParentBeforeParentDelete()
+template<typename Base>
+void WebEngineDelegateWidgetBase<Base>::connectRemoveParentBeforeParentDelete()
 {
-    disconnect(m_parentDestroyedConnection);
+    QObject::disconnect(m_parentDestroyedConnection);
 
-    if (QWidget *parent = parentWidget()) {
-        m_parentDestroyedConnection = connect(parent, &QObject::destroyed,
-                                              this,
-                                              &WebEngineQuickWidget::removeParentBeforeParentDelete);
+    if (QWidget *parent = Base::parentWidget()) {
+        m_parentDestroyedConnection = QObject::connect(parent, &QObject::destroyed,
+                                                       this,
+                                                       &WebEngineDelegateWidgetBase::removeParentBeforeParentDelete);
     } else {
         m_parentDestroyedConnection = QMetaObject::Connection();
     }
 }
 
-void WebEngineQuickWidget::removeParentBeforeParentDelete()
+template<typename Base>
+void WebEngineDelegateWidgetBase<Base>::removeParentBeforeParentDelete()
 {
     // Unset the parent, because parent is being destroyed, but the owner of this
-    // WebEngineQuickWidget is actually a RenderWidgetHostViewQt instance.
-    setParent(nullptr);
+    // widget is actually a RenderWidgetHostViewQt instance.
+    Base::setParent(nullptr);
 
     // If this widget represents a popup window, make sure to close it, so that if the popup was the
     // last visible top level window, the application event loop can quit if it deems it necessarry.
     if (m_contentItem && m_contentItem->m_isPopup)
-        close();
+        Base::close();
 }
 
-bool WebEngineQuickWidget::event(QEvent *event)
+template<typename Base>
+bool WebEngineDelegateWidgetBase<Base>::event(QEvent *event)
 {
     bool handled = false;
 
@@ -292,11 +286,11 @@ bool WebEngineQuickWidget::event(QEvent *event)
         connectRemoveParentBeforeParentDelete();
 
     if (!m_contentItem)
-        return QQuickWidget::event(event);
+        return Base::event(event);
 
     // Mimic QWidget::event() by ignoring mouse, keyboard, touch and tablet events if the widget is
     // disabled.
-    if (!isEnabled()) {
+    if (!Base::isEnabled()) {
         switch (event->type()) {
         case QEvent::TabletPress:
         case QEvent::TabletRelease:
@@ -324,8 +318,11 @@ bool WebEngineQuickWidget::event(QEvent *event)
     switch (event->type()) {
     case QEvent::FocusIn:
     case QEvent::FocusOut:
-        // We forward focus events later, once they have made it to the content item.
-        return QQuickWidget::event(event);
+        // We forward focus events later, once they have made it to the content item,
+        // unless there is no scene the content item is part of.
+        if (!PaintsContents())
+            return Base::event(event);
+        break;
     case QEvent::DragEnter:
     case QEvent::DragLeave:
     case QEvent::DragMove:
@@ -352,7 +349,7 @@ bool WebEngineQuickWidget::event(QEvent *event)
             // which is expected to get input through synthesized mouse events (either by system or Qt)
             if (!m_contentItem->m_isPopup &&
                     static_cast<QMouseEvent *>(event)->source() == Qt::MouseEventSynthesizedBySystem) {
-                Q_ASSERT(!windowFlags().testFlag(Qt::Popup));
+                Q_ASSERT(!Base::windowFlags().testFlag(Qt::Popup));
                 return true;
             }
             break;
@@ -374,11 +371,192 @@ bool WebEngineQuickWidget::event(QEvent *event)
         handled = m_contentItem->m_client->forwardEvent(event);
 
     if (!handled)
-        return QQuickWidget::event(event);
+        return Base::event(event);
     event->accept();
     return true;
 }
 
+// Hosts the content item in the scene of a QQuickWidget.
+class WebEngineQuickWidget : public WebEngineDelegateWidgetBase<QQuickWidget>
+{
+public:
+    WebEngineQuickWidget(RenderWidgetHostViewQtDelegateItem *widget, QWidget *parent)
+        : WebEngineDelegateWidgetBase(widget, parent)
+    {
+        QQuickItem *root = new QQuickItem(); // Indirection so we don't delete m_contentItem
+        setContent(QUrl(), nullptr, root);
+        root->setFlags(QQuickItem::ItemHasContents);
+        root->setVisible(true);
+        m_contentItem->setParentItem(root);
+    }
+    ~WebEngineQuickWidget() override
+    {
+        if (m_contentItem) {
+            m_contentItem->setWidgetDelegate(nullptr);
+            m_contentItem->setParentItem(nullptr);
+        }
+    }
+
+    void SetClearColor(const QColor &color) override
+    {
+        setUpdatesEnabled(false);
+        QQuickWidget::setClearColor(color);
+        // QQuickWidget is usually blended by punching holes into widgets
+        // above it to simulate the visual stacking order. If we want it to be
+        // transparent we have to throw away the proper stacking order and always
+        // blend the complete normal widgets backing store under it.
+        bool isTranslucent = color.alpha() < 255;
+        setAttribute(Qt::WA_AlwaysStackOnTop, isTranslucent);
+        setAttribute(Qt::WA_OpaquePaintEvent, !isTranslucent);
+        setUpdatesEnabled(true);
+        window()->update();
+    }
+};
+
+// Paints the frames of the software compositor directly into the widget's
+// backing store, without the offscreen window and scene graph of a QQuickWidget.
+class WebEngineRasterWidget : public WebEngineDelegateWidgetBase<QWidget>
+{
+public:
+    WebEngineRasterWidget(RenderWidgetHostViewQtDelegateItem *widget, QWidget *parent)
+        : WebEngineDelegateWidgetBase(widget, parent)
+    {
+    }
+    ~WebEngineRasterWidget() override
+    {
+        if (m_contentItem)
+            m_contentItem->setWidgetDelegate(nullptr);
+    }
+
+    void SetClearColor(const QColor &color) override
+    {
+        m_clearColor = color;
+        setAttribute(Qt::WA_OpaquePaintEvent, color.alpha() == 255);
+        update();
+    }
+
+    bool PaintsContents() override { return true; }
+    void Update() override;
+    QRectF ViewGeometry() override { return QRectF(mapToGlobal(QPoint(0, 0)), QSizeF(size())); }
+    void SetKeyboardFocus() override { setFocus(); }
+    bool HasKeyboardFocus() override { return hasFocus(); }
+    void LockMouse() override { grabMouse(); }
+    void UnlockMouse() override { releaseMouse(); }
+
+protected:
+    bool event(QEvent *event) override
+    {
+        if (event->type() == QEvent::DevicePixelRatioChange && m_contentItem)
+            m_contentItem->onWindowPosChanged();
+        return WebEngineDelegateWidgetBase::event(event);
+    }
+    void showEvent(QShowEvent *event) override
+    {
+        WebEngineDelegateWidgetBase::showEvent(event);
+        if (m_swapPending)
+            Update();
+    }
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    // A frame arrived while hidden and waits to be swapped in.
+    bool m_swapPending = false;
+    QImage m_image;
+    qreal m_devicePixelRatio = 1.0;
+    QColor m_clearColor = Qt::white;
+};
+
+// Called on a new compositor frame.
+void WebEngineRasterWidget::Update()
+{
+    if (!m_contentItem)
+        return;
+
+    // Like the scene graph of a hidden QQuickWidget, leave the frame unswapped.
+    // This holds back the compositor until the widget is shown again.
+    if (!isVisible()) {
+        m_swapPending = true;
+        return;
+    }
+    m_swapPending = false;
+
+    const QSize oldSize = m_image.size();
+    QRegion damage;
+    {
+        auto comp = m_contentItem->compositor();
+        if (!comp)
+            return;
+        comp->swapFrame();
+        if (comp->type() != Compositor::Type::Software) {
+            static bool warned = false;
+            if (!warned) {
+                qWarning("Painting web content without Qt Quick requires software compositing.");
+                warned = true;
+            }
+            return;
+        }
+        m_image = comp->image(&damage);
+        m_devicePixelRatio = comp->devicePixelRatio();
+    }
+
+    if (m_image.size() != oldSize) {
+        update();
+        return;
+    }
+    for (const QRect &rect : damage) {
+        update(QRectF(QPointF(rect.topLeft()) / m_devicePixelRatio,
+                      QSizeF(rect.size()) / m_devicePixelRatio)
+                       .toAlignedRect());
+    }
+}
+
+void WebEngineRasterWidget::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+    const QRectF imageRect(QPointF(), QSizeF(m_image.size()) / m_devicePixelRatio);
+
+    const QRegion uncovered = event->region() - imageRect.toRect();
+    for (const QRect &rect : uncovered)
+        painter.fillRect(rect, m_clearColor);
+
+    if (m_image.isNull())
+        return;
+
+    // The frame already contains the page background, blending it over the
+    // widgets below is only necessary for a translucent view.
+    if (m_clearColor.alpha() == 255)
+        painter.setCompositionMode(QPainter::CompositionMode_Source);
+    for (const QRect &rect : event->region()) {
+        const QRectF target = QRectF(rect) & imageRect;
+        if (target.isEmpty())
+            continue;
+        const QRectF source(target.topLeft() * m_devicePixelRatio,
+                            target.size() * m_devicePixelRatio);
+        painter.drawImage(target, m_image, source);
+    }
+}
+
+// Creates the widget hosting item.
+//
+// Painting directly into the backing store is opted in with QTWEBENGINE_RASTER_WIDGETS,
+// and only possible when the software Qt Quick backend, and therefore the software
+// compositor, is used. The compositor is only known after the first frame, so the
+// choice follows the application-wide QQuickWindow::graphicsApi(), which also decides
+// whether web engine uses the GPU. Both are read once, when the first view is created.
+static WebEngineDelegateWidget *createDelegateWidget(RenderWidgetHostViewQtDelegateItem *item,
+                                                     QWidget *parent)
+{
+    static const bool useRasterWidget = qEnvironmentVariableIntValue("QTWEBENGINE_RASTER_WIDGETS")
+            && QQuickWindow::graphicsApi() == QSGRendererInterface::Software;
+    WebEngineDelegateWidget *widget;
+    if (useRasterWidget)
+        widget = new WebEngineRasterWidget(item, parent);
+    else
+        widget = new WebEngineQuickWidget(item, parent);
+    item->setWidgetDelegate(widget);
+    return widget;
+}
+
 } // namespace QtWebEngineCore
 
 QT_BEGIN_NAMESPACE
@@ -434,10 +612,12 @@ void QWebEngineViewPrivate::pageChanged(QWebEnginePage *oldPage, QWebEnginePage
         Q_EMIT q->selectionChanged();
 }
 
-void QWebEngineViewPrivate::widgetChanged(QtWebEngineCore::WebEngineQuickWidget *oldWidget,
-                                          QtWebEngineCore::WebEngineQuickWidget *newWidget)
+void QWebEngineViewPrivate::widgetChanged(QtWebEngineCore::WebEngineDelegateWidget *oldDelegate,
+                                          QtWebEngineCore::WebEngineDelegateWidget *newDelegate)
 {
     Q_Q(QWebEngineView);
+    QWidget *oldWidget = oldDelegate ? oldDelegate->widget() : nullptr;
+    QWidget *newWidget = newDelegate ? newDelegate->widget() : nullptr;
 
     bool hasFocus = oldWidget ? oldWidget->hasFocus() : false;
     if (oldWidget) {
@@ -715,8 +895,8 @@ void QWebEngineViewPrivate::bindPageAndView(QWebEnginePage *page, QWebEngineView
 
     auto item = page ? page->d_func()->delegateItem : nullptr;
     auto oldItem = (oldPage && oldPage->d_func()) ? oldPage->d_func()->delegateItem : nullptr;
-    auto widget = item ? static_cast<QtWebEngineCore::WebEngineQuickWidget *>(item->m_widgetDelegate) : nullptr;
-    auto oldWidget = oldItem ? static_cast<QtWebEngineCore::WebEngineQuickWidget *>(oldItem->m_widgetDelegate) : nullptr;
+    auto widget = item ? static_cast<QtWebEngineCore::WebEngineDelegateWidget *>(item->m_widgetDelegate) : nullptr;
+    auto oldWidget = oldItem ? static_cast<QtWebEngineCore::WebEngineDelegateWidget *>(oldItem->m_widgetDelegate) : nullptr;
 
     // New page/widget moving away from oldView
     if (page && oldView != view && oldView) {
@@ -731,10 +911,8 @@ void QWebEngineViewPrivate::bindPageAndView(QWebEnginePage *page, QWebEngineView
             view->d_func()->pageChanged(oldPage, page);
         else
             view->d_func()->pageChanged(nullptr, page);
-        if (!widget && item) {
-            widget = new QtWebEngineCore::WebEngineQuickWidget(item, nullptr);
-            item->setWidgetDelegate(widget);
-        }
+        if (!widget && item)
+            widget = QtWebEngineCore::createDelegateWidget(item, nullptr);
         if (oldWidget != widget)
             view->d_func()->widgetChanged(oldWidget, widget);
     }
@@ -744,12 +922,12 @@ void QWebEngineViewPrivate::bindPageAndView(QWebEnginePage *page, QWebEngineView
 
 // static
 void QWebEngineViewPrivate::bindPageAndWidget(QWebEnginePagePrivate *pagePrivate,
-                                              QtWebEngineCore::WebEngineQuickWidget *widget)
+                                              QtWebEngineCore::WebEngineDelegateWidget *widget)
 {
     auto *oldAdapterClient = (widget && widget->m_contentItem) ? widget->m_contentItem->m_adapterClient : nullptr;
     auto *oldPagePrivate = static_cast<QWebEnginePagePrivate *>(oldAdapterClient);
     auto *oldItem = pagePrivate ? pagePrivate->delegateItem : nullptr;
-    auto *oldWidget = oldItem ? static_cast<QtWebEngineCore::WebEngineQuickWidget *>(oldItem->m_widgetDelegate) : nullptr;
+    auto *oldWidget = oldItem ? static_cast<QtWebEngineCore::WebEngineDelegateWidget *>(oldItem->m_widgetDelegate) : nullptr;
 
     // Change pointers first.
 
@@ -919,8 +1097,7 @@ QWebEngineViewPrivate::CreateRenderWidgetHostViewQtDelegate(
         QtWebEngineCore::RenderWidgetHostViewQtDelegateClient *client)
 {
     auto *item = new QtWebEngineCore::RenderWidgetHostViewQtDelegateItem(client, false);
-    auto *widget = new QtWebEngineCore::WebEngineQuickWidget(item, nullptr);
-    item->setWidgetDelegate(widget);
+    QtWebEngineCore::createDelegateWidget(item, nullptr);
     return item;
 }
 
@@ -930,8 +1107,7 @@ QWebEngineViewPrivate::CreateRenderWidgetHostViewQtDelegateForPopup(
 {
     Q_Q(QWebEngineView);
     auto *item = new QtWebEngineCore::RenderWidgetHostViewQtDelegateItem(client, true);
-    auto *widget = new QtWebEngineCore::WebEngineQuickWidget(item, q);
-    item->setWidgetDelegate(widget);
+    QtWebEngineCore::createDelegateWidget(item, q);
     return item;
 }
 
@@ -24,7 +24,7 @@
 namespace QtWebEngineCore {
 class AutofillPopupController;
 class QWebEngineContextMenuRequest;
-class WebEngineQuickWidget;
+class WebEngineDelegateWidget;
 class RenderWidgetHostViewQtDelegate;
 class RenderWidgetHostViewQtDelegateClient;
 class TouchSelectionMenuController;
@@ -49,8 +49,8 @@ public:
     QWebEngineView *q_ptr;
 
     void pageChanged(QWebEnginePage *oldPage, QWebEnginePage *newPage);
-    void widgetChanged(QtWebEngineCore::WebEngineQuickWidget *oldWidget,
-                       QtWebEngineCore::WebEngineQuickWidget *newWidget);
+    void widgetChanged(QtWebEngineCore::WebEngineDelegateWidget *oldWidget,
+                       QtWebEngineCore::WebEngineDelegateWidget *newWidget);
 
     void contextMenuRequested(QWebEngineContextMenuRequest *request) override;
     QStringList chooseFiles(QWebEnginePage::FileSelectionMode mode, const QStringList &oldFiles,
@@ -87,7 +87,7 @@ public:
     virtual ~QWebEngineViewPrivate();
     static void bindPageAndView(QWebEnginePage *page, QWebEngineView *view);
     static void bindPageAndWidget(QWebEnginePagePrivate *pagePrivate,
-                                  QtWebEngineCore::WebEngineQuickWidget *widget);
+                                  QtWebEngineCore::WebEngineDelegateWidget *widget);
     QIcon webActionIcon(QWebEnginePage::WebAction action) const;
     void unhandledKeyEvent(QKeyEvent *event) override;
     void focusContainer() override;
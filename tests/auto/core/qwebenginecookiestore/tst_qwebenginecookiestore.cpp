@@ -40,6 +40,7 @@ private Q_SLOTS:
     void basicFilter();
     void basicFilterOverHTTP();
     void html5featureFilter();
+    void cookiePolicy();
 
 private:
     QWebEngineProfile *m_profile;
@@ -368,5 +369,99 @@ void tst_QWebEngineCookieStore::html5featureFilter()
     QWE_TRY_VERIFY(callbackTriggered);
 }
 
+void tst_QWebEngineCookieStore::cookiePolicy()
+{
+    QWebEnginePage page(m_profile);
+    QWebEngineCookieStore *client = m_profile->cookieStore();
+
+    QAtomicInt accessTested = 0;
+    QAtomicInt thirdPartyTested = 0;
+    client->setCookieFilter([&](const QWebEngineCookieStore::FilterRequest &request) {
+        ++accessTested;
+        if (request.thirdParty)
+            ++thirdPartyTested;
+        return true;
+    });
+    client->setThirdPartyCookiesBlocked(true);
+    QVERIFY(client->thirdPartyCookiesBlocked());
+
+    HttpServer httpServer;
+    httpServer.setHostDomain(QString("first.localhost"));
+    QVERIFY(httpServer.start());
+    QUrl thirdPartyUrl = httpServer.url("/pixel.png");
+    thirdPartyUrl.setHost("third.localhost");
+
+    connect(&httpServer, &HttpServer::newRequest, [&thirdPartyUrl](HttpReqRep *rr) {
+        if (rr->requestPath() == "/page.html") {
+            rr->setResponseHeader(QByteArrayLiteral("Set-Cookie"), QByteArrayLiteral("First=1"));
+            rr->setResponseBody("<html><body><img src='" + thirdPartyUrl.toEncoded()
+                                + "'></body></html>");
+            rr->sendResponse();
+        } else if (rr->requestPath() == "/pixel.png") {
+            rr->setResponseHeader(QByteArrayLiteral("Set-Cookie"), QByteArrayLiteral("Third=1"));
+            rr->sendResponse();
+        }
+    });
+
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    QSignalSpy cookieAddedSpy(client, SIGNAL(cookieAdded(const QNetworkCookie &)));
+    QSignalSpy cookieRemovedSpy(client, SIGNAL(cookieRemoved(const QNetworkCookie &)));
+    auto addedCookieNames = [&cookieAddedSpy]() {
+        QStringList names;
+        for (const QList<QVariant> &args : std::as_const(cookieAddedSpy))
+            names.append(QString::fromLatin1(args.at(0).value<QNetworkCookie>().name()));
+        names.sort();
+        return names;
+    };
+
+    // Third-party cookies are blocked without asking the filter.
+    page.load(httpServer.url("/page.html"));
+    QWE_TRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.takeFirst().takeFirst().toBool());
+    QWE_TRY_COMPARE(cookieAddedSpy.size(), 1);
+    QTest::qWait(100);
+    QCOMPARE(addedCookieNames(), QStringList({ "First" }));
+    QVERIFY(accessTested.loadAcquire() > 0);
+    QCOMPARE(thirdPartyTested.loadAcquire(), 0);
+
+    client->deleteAllCookies();
+    QWE_TRY_COMPARE(cookieRemovedSpy.size(), 1);
+    cookieAddedSpy.clear();
+    cookieRemovedSpy.clear();
+
+    // Allowed domains are exempt from third-party blocking.
+    client->setAllowedCookieDomains({ "third.localhost" });
+    page.triggerAction(QWebEnginePage::ReloadAndBypassCache);
+    QWE_TRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.takeFirst().takeFirst().toBool());
+    QWE_TRY_COMPARE(cookieAddedSpy.size(), 2);
+    QCOMPARE(addedCookieNames(), QStringList({ "First", "Third" }));
+    QCOMPARE(thirdPartyTested.loadAcquire(), 0);
+
+    client->deleteAllCookies();
+    QWE_TRY_COMPARE(cookieRemovedSpy.size(), 2);
+    cookieAddedSpy.clear();
+
+    // Blocked domains cover subdomains, first-party ones included, and win over allowed ones.
+    client->setBlockedCookieDomains({ "localhost" });
+    accessTested = 0;
+    page.triggerAction(QWebEnginePage::ReloadAndBypassCache);
+    QWE_TRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.takeFirst().takeFirst().toBool());
+    QTest::qWait(100);
+    QCOMPARE(cookieAddedSpy.size(), 0);
+    QCOMPARE(accessTested.loadAcquire(), 0);
+
+    (void) httpServer.stop();
+
+    client->setBlockedCookieDomains({});
+    client->setAllowedCookieDomains({});
+    client->setThirdPartyCookiesBlocked(false);
+    client->setCookieFilter(nullptr);
+    QVERIFY(client->blockedCookieDomains().isEmpty());
+    QVERIFY(client->allowedCookieDomains().isEmpty());
+    QVERIFY(!client->thirdPartyCookiesBlocked());
+}
+
 QTEST_MAIN(tst_QWebEngineCookieStore)
 #include "tst_qwebenginecookiestore.moc"
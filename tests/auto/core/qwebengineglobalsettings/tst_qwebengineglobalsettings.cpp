@@ -9,10 +9,13 @@
 #include <QWebEnginePage>
 #include <QWebEngineGlobalSettings>
 #include <QWebEngineLoadingInfo>
+#include <QtWebEngineCore/private/qwebengineglobalsettings_p.h>
 
 #include "httpsserver.h"
 #include "httpreqrep.h"
 
+#include <numeric>
+
 class tst_QWebEngineGlobalSettings : public QObject
 {
     Q_OBJECT
@@ -30,6 +33,9 @@ private Q_SLOTS:
     void cleanupTestCase() { }
     void dnsOverHttps_data();
     void dnsOverHttps();
+    void workBudget();
+    void workBudgetAdapts();
+    void messagePumpStatistics();
 };
 
 void tst_QWebEngineGlobalSettings::dnsOverHttps_data()
@@ -122,6 +128,101 @@ void tst_QWebEngineGlobalSettings::dnsOverHttps()
     QVERIFY(httpsServer.stop());
 }
 
+void tst_QWebEngineGlobalSettings::workBudget()
+{
+    using namespace std::chrono_literals;
+    const QWebEngineGlobalSettings::WorkBudget defaultBudget =
+            QWebEngineGlobalSettings::workBudget();
+    QVERIFY(defaultBudget.minimum > 0us);
+    QVERIFY(defaultBudget.minimum <= defaultBudget.maximum);
+
+    QVERIFY(!QWebEngineGlobalSettings::setWorkBudget({ 0us, 2ms }));
+    QVERIFY(!QWebEngineGlobalSettings::setWorkBudget({ 4ms, 2ms }));
+    QCOMPARE(QWebEngineGlobalSettings::workBudget().minimum, defaultBudget.minimum);
+    QCOMPARE(QWebEngineGlobalSettings::workBudget().maximum, defaultBudget.maximum);
+
+    QVERIFY(QWebEngineGlobalSettings::setWorkBudget({ 1ms, 1ms }));
+    QCOMPARE(QWebEngineGlobalSettings::workBudget().minimum, 1ms);
+    QCOMPARE(QWebEngineGlobalSettings::workBudget().maximum, 1ms);
+
+    // Tasks keep running with a fixed budget.
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    page.setHtml(QStringLiteral("<html><body>budget</body></html>"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.first().first().toBool());
+
+    QVERIFY(QWebEngineGlobalSettings::setWorkBudget(defaultBudget));
+}
+
+void tst_QWebEngineGlobalSettings::workBudgetAdapts()
+{
+    using namespace std::chrono_literals;
+    QWebEngineGlobalSettingsPrivate *settings = QWebEngineGlobalSettingsPrivate::instance();
+    QCOMPARE(QWebEngineGlobalSettings::workBudget().minimum, 2ms);
+    QCOMPARE(QWebEngineGlobalSettings::workBudget().maximum, 2ms);
+
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    page.setHtml(QStringLiteral("<html><body>burst</body></html>"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+
+    // Each result is delivered by a task on the UI thread, so a burst of scripts
+    // keeps the message pump busy for longer than a slice.
+    int pendingResults = 0;
+    auto runBurst = [&]() {
+        for (int i = 0; i < 2000; ++i) {
+            ++pendingResults;
+            page.runJavaScript(QString::number(i), [&](const QVariant &) { --pendingResults; });
+        }
+        QTRY_COMPARE_WITH_TIMEOUT(pendingResults, 0, 20000);
+    };
+
+    // Without opting in, the slice keeps the fixed default.
+    runBurst();
+    QCOMPARE(settings->currentWorkBudget, 2ms);
+
+    // With a range, slices grow while the Qt event loop is idle.
+    QVERIFY(QWebEngineGlobalSettings::setWorkBudget({}));
+    bool adapted = false;
+    for (int attempt = 0; attempt < 10 && !adapted; ++attempt) {
+        runBurst();
+        adapted = settings->currentWorkBudget > 2ms;
+    }
+    QVERIFY(adapted);
+    QVERIFY(settings->currentWorkBudget <= QWebEngineGlobalSettings::workBudget().maximum);
+
+    QVERIFY(QWebEngineGlobalSettings::setWorkBudget({ 2ms, 2ms }));
+    runBurst();
+    QCOMPARE(settings->currentWorkBudget, 2ms);
+}
+
+void tst_QWebEngineGlobalSettings::messagePumpStatistics()
+{
+    QWebEngineGlobalSettings::resetMessagePumpStatistics();
+    QCOMPARE(QWebEngineGlobalSettings::messagePumpStatistics().slices(), 0u);
+
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    page.setHtml(QStringLiteral("<html><body>statistics</body></html>"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+
+    const QWebEngineMessagePumpStatistics statistics =
+            QWebEngineGlobalSettings::messagePumpStatistics();
+    QVERIFY(statistics.slices() > 0);
+    QVERIFY(statistics.workIterations() >= statistics.slices());
+    QVERIFY(statistics.expiredSlices() <= statistics.slices());
+    QVERIFY(statistics.averageQueueDelay() <= statistics.maximumQueueDelay());
+
+    const QList<quint64> queueDelays = statistics.queueDelayHistogram();
+    const QList<quint64> workIterations = statistics.workIterationsHistogram();
+    QCOMPARE(queueDelays.size(), workIterations.size());
+    QCOMPARE(std::accumulate(queueDelays.begin(), queueDelays.end(), quint64(0)),
+             statistics.slices());
+    QCOMPARE(std::accumulate(workIterations.begin(), workIterations.end(), quint64(0)),
+             statistics.slices());
+}
+
 static QByteArrayList params = QByteArrayList() << "--ignore-certificate-errors";
 
 W_QTEST_MAIN(tst_QWebEngineGlobalSettings, params)
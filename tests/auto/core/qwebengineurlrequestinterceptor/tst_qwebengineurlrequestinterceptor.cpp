@@ -5,9 +5,12 @@
 
 #include <util.h>
 #include <QtTest/QtTest>
+#include <QtWebEngineCore/qwebengineurlrequestdecision.h>
 #include <QtWebEngineCore/qwebengineurlrequestinfo.h>
 #include <QtWebEngineCore/private/qwebengineurlrequestinfo_p.h>
 #include <QtWebEngineCore/qwebengineurlrequestinterceptor.h>
+#include <QtWebEngineCore/qwebengineurlrequestrule.h>
+#include <QtWebEngineCore/qwebengineurlresponseinterceptor.h>
 #include <QtWebEngineCore/qwebenginesettings.h>
 #include <QtWebEngineCore/qwebengineprofile.h>
 #include <QtWebEngineCore/qwebenginepage.h>
@@ -16,6 +19,8 @@
 #include <httpserver.h>
 #include <httpreqrep.h>
 
+#include <atomic>
+
 class tst_QWebEngineUrlRequestInterceptor : public QObject
 {
     Q_OBJECT
@@ -56,6 +61,12 @@ private Q_SLOTS:
     void profilePreventsPageInterception_data();
     void profilePreventsPageInterception();
     void download();
+    void deferredDecision_data();
+    void deferredDecision();
+    void urlRequestRules_data();
+    void urlRequestRules();
+    void interestFilters();
+    void responseTransform();
 };
 
 tst_QWebEngineUrlRequestInterceptor::tst_QWebEngineUrlRequestInterceptor()
@@ -1145,5 +1156,216 @@ void tst_QWebEngineUrlRequestInterceptor::download()
     QCOMPARE(interceptor.requestInfos.at(0).download, true);
 }
 
+class DeferringInterceptor : public QWebEngineUrlRequestInterceptor
+{
+public:
+    ~DeferringInterceptor() override
+    {
+        for (QThread *thread : std::as_const(threads)) {
+            thread->wait();
+            delete thread;
+        }
+    }
+
+    void interceptRequest(QWebEngineUrlRequestInfo &info) override
+    {
+        QWebEngineUrlRequestDecision decision = info.defer();
+        QVERIFY(decision.isValid());
+        // Decide later on another thread, as a policy service would.
+        QThread *thread = QThread::create([decision, block = shouldBlock]() mutable {
+            QThread::msleep(50);
+            decision.block(block);
+            decision.complete();
+        });
+        thread->start();
+        threads.append(thread);
+    }
+
+    bool shouldBlock = false;
+    QList<QThread *> threads;
+};
+
+void tst_QWebEngineUrlRequestInterceptor::deferredDecision_data()
+{
+    QTest::addColumn<bool>("shouldBlock");
+    QTest::newRow("allow") << false;
+    QTest::newRow("block") << true;
+}
+
+void tst_QWebEngineUrlRequestInterceptor::deferredDecision()
+{
+    QFETCH(bool, shouldBlock);
+
+    QWebEngineProfile profile;
+    DeferringInterceptor interceptor;
+    interceptor.shouldBlock = shouldBlock;
+    profile.setUrlRequestInterceptor(&interceptor);
+    profile.settings()->setAttribute(QWebEngineSettings::ErrorPageEnabled, false);
+
+    QWebEnginePage page(&profile);
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.load(QUrl("qrc:///resources/content.html"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QCOMPARE(loadSpy.at(0).first().toBool(), !shouldBlock);
+    QVERIFY(!interceptor.threads.isEmpty());
+}
+
+void tst_QWebEngineUrlRequestInterceptor::urlRequestRules_data()
+{
+    using Rule = QWebEngineUrlRequestRule;
+    QTest::addColumn<QList<Rule>>("rules");
+    QTest::addColumn<QUrl>("url");
+    QTest::addColumn<bool>("loadSucceeds");
+    QTest::addColumn<QUrl>("finalUrl");
+
+    const QUrl content("qrc:///resources/content.html");
+    const QUrl placeholder("qrc:///resources/__placeholder__");
+    Rule redirect("__placeholder__|", Rule::Action::Redirect);
+    redirect.setRedirectUrl(content);
+    Rule blockOtherTypes("content.html", Rule::Action::Block);
+    blockOtherTypes.setResourceTypes({ QWebEngineUrlRequestInfo::ResourceTypeImage });
+
+    QTest::newRow("no match") << QList<Rule>{ Rule("nothing*here", Rule::Action::Block) }
+                              << content << true << content;
+    QTest::newRow("block") << QList<Rule>{ Rule("/RESOURCES/content.", Rule::Action::Block) }
+                           << content << false << content;
+    QTest::newRow("block anchored") << QList<Rule>{ Rule("|qrc:*content.html^", Rule::Action::Block) }
+                                    << content << false << content;
+    QTest::newRow("block other type") << QList<Rule>{ blockOtherTypes } << content << true << content;
+    QTest::newRow("allow wins") << QList<Rule>{ Rule("content", Rule::Action::Block),
+                                                Rule("*.html|", Rule::Action::Allow) }
+                                << content << true << content;
+    QTest::newRow("redirect") << QList<Rule>{ redirect } << placeholder << true << content;
+    QTest::newRow("block wins") << QList<Rule>{ redirect, Rule("placeholder", Rule::Action::Block) }
+                                << placeholder << false << placeholder;
+}
+
+void tst_QWebEngineUrlRequestInterceptor::urlRequestRules()
+{
+    QFETCH(QList<QWebEngineUrlRequestRule>, rules);
+    QFETCH(QUrl, url);
+    QFETCH(bool, loadSucceeds);
+    QFETCH(QUrl, finalUrl);
+
+    QWebEngineProfile profile;
+    profile.settings()->setAttribute(QWebEngineSettings::ErrorPageEnabled, false);
+    profile.setUrlRequestRules(rules);
+    QCOMPARE(profile.urlRequestRules().size(), rules.size());
+    TestRequestInterceptor interceptor(/* intercept */ false);
+    profile.setUrlRequestInterceptor(&interceptor);
+
+    QWebEnginePage page(&profile);
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.load(url);
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QCOMPARE(loadSpy.at(0).first().toBool(), loadSucceeds);
+    if (loadSucceeds)
+        QCOMPARE(page.url(), finalUrl);
+
+    // Rules that block or redirect a request take it away from the interceptor.
+    for (const RequestInfo &info : std::as_const(interceptor.requestInfos))
+        QVERIFY(info.requestUrl != url || (loadSucceeds && url == finalUrl));
+
+    profile.setUrlRequestRules({});
+    QVERIFY(profile.urlRequestRules().isEmpty());
+}
+
+void tst_QWebEngineUrlRequestInterceptor::interestFilters()
+{
+    QWebEngineProfile profile;
+    TestRequestInterceptor interceptor(/* intercept */ false);
+    interceptor.setResourceTypeFilter({ QWebEngineUrlRequestInfo::ResourceTypeMainFrame });
+    QCOMPARE(interceptor.resourceTypeFilter(),
+             QList<QWebEngineUrlRequestInfo::ResourceType>{ QWebEngineUrlRequestInfo::ResourceTypeMainFrame });
+    profile.setUrlRequestInterceptor(&interceptor);
+
+    QWebEnginePage page(&profile);
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.load(QUrl("qrc:///resources/resource.html"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.takeFirst().first().toBool());
+    // The stylesheet and script of the page don't pass the filter.
+    QVERIFY(!interceptor.requestInfos.isEmpty());
+    for (const RequestInfo &info : std::as_const(interceptor.requestInfos))
+        QCOMPARE(info.resourceType, int(QWebEngineUrlRequestInfo::ResourceTypeMainFrame));
+
+    interceptor.requestInfos.clear();
+    interceptor.setSchemeFilter({ QStringLiteral("HTTPS") });
+    QCOMPARE(interceptor.schemeFilter(), QStringList{ QStringLiteral("HTTPS") });
+    page.load(QUrl("qrc:///resources/content.html"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.takeFirst().first().toBool());
+    QVERIFY(interceptor.requestInfos.isEmpty());
+
+    interceptor.setResourceTypeFilter({});
+    interceptor.setSchemeFilter({});
+    interceptor.setHostFilter({ QStringLiteral("example.com") });
+    QCOMPARE(interceptor.hostFilter(), QStringList{ QStringLiteral("example.com") });
+    page.load(QUrl("qrc:///resources/content.html"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(interceptor.requestInfos.isEmpty());
+
+    interceptor.setHostFilter({});
+    page.load(QUrl("qrc:///resources/resource.html"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QTRY_VERIFY(!interceptor.getUrlRequestForType(QWebEngineUrlRequestInfo::ResourceTypeStylesheet).isEmpty());
+}
+
+class ReplacingTransformer : public QWebEngineUrlResponseBodyTransformer
+{
+public:
+    ReplacingTransformer(std::atomic<bool> *offThread) : offThread(offThread) { }
+
+    QByteArray transform(QByteArrayView chunk) override
+    {
+        if (QThread::currentThread() != QCoreApplication::instance()->thread())
+            offThread->store(true);
+        return chunk.toByteArray().replace("Simple test page", "Rewritten test page");
+    }
+
+    QByteArray finish() override { return "<p>Appended at the end</p>"; }
+
+    std::atomic<bool> *offThread;
+};
+
+class TransformingResponseInterceptor : public QWebEngineUrlResponseInterceptor
+{
+public:
+    void interceptResponse(QWebEngineUrlResponseInfo &info) override
+    {
+        if (info.resourceType() != QWebEngineUrlRequestInfo::ResourceTypeMainFrame)
+            return;
+        urls.append(info.requestUrl());
+        info.setResponseHeader("X-Test", "1");
+        QVERIFY(info.responseHeaders().contains("X-Test"));
+        info.setBodyTransformer(new ReplacingTransformer(&offThread));
+    }
+
+    QList<QUrl> urls;
+    std::atomic<bool> offThread = false;
+};
+
+void tst_QWebEngineUrlRequestInterceptor::responseTransform()
+{
+    QWebEngineProfile profile;
+    TransformingResponseInterceptor interceptor;
+    profile.setUrlResponseInterceptor(&interceptor);
+
+    QWebEnginePage page(&profile);
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.load(QUrl("qrc:///resources/content.html"));
+    QTRY_COMPARE(loadSpy.size(), 1);
+    QVERIFY(loadSpy.at(0).first().toBool());
+    QCOMPARE(interceptor.urls, QList<QUrl>{ QUrl("qrc:///resources/content.html") });
+
+    const QString text = toPlainTextSync(&page);
+    QVERIFY2(text.contains("Rewritten test page"), qPrintable(text));
+    QVERIFY(!text.contains("Simple test page"));
+    QVERIFY(text.contains("Appended at the end"));
+    QVERIFY(interceptor.offThread);
+
+    profile.setUrlResponseInterceptor(nullptr);
+}
+
 QTEST_MAIN(tst_QWebEngineUrlRequestInterceptor)
 #include "tst_qwebengineurlrequestinterceptor.moc"
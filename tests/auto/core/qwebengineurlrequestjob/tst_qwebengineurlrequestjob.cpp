@@ -3,6 +3,7 @@
 
 #include <QtTest/QtTest>
 #include <util.h>
+#include <QResource>
 #include <QtWebEngineCore/qwebengineloadinginfo.h>
 #include <QtWebEngineCore/qwebengineurlschemehandler.h>
 #include <QtWebEngineCore/qwebengineurlscheme.h>
@@ -155,6 +156,198 @@ public:
     const static inline QByteArray schemeName = QByteArrayLiteral("success");
 };
 
+class DataHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        requestJob->reply("text/plain;charset=utf-8", requestJob->requestUrl().toString().toUtf8());
+    }
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme dataScheme(schemeName);
+        QWebEngineUrlScheme::registerScheme(dataScheme);
+    }
+
+    const static inline QByteArray schemeName = QByteArrayLiteral("datareply");
+};
+
+// Serves a page, and a body too large to be written to the data pipe at once.
+class LargeDataHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        if (requestJob->requestUrl().path() == QLatin1String("page")) {
+            requestJob->reply("text/html", QByteArrayLiteral("<html><body>page</body></html>"));
+            return;
+        }
+        requestJob->reply("text/plain", body());
+    }
+
+    static QByteArray body()
+    {
+        QByteArray data(kSize, Qt::Uninitialized);
+        for (qsizetype i = 0; i < data.size(); ++i)
+            data[i] = char('a' + i % 26);
+        return data;
+    }
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme largeDataScheme(schemeName);
+        largeDataScheme.setFlags(QWebEngineUrlScheme::CorsEnabled);
+        QWebEngineUrlScheme::registerScheme(largeDataScheme);
+    }
+
+    static constexpr qsizetype kSize = 6 * 1024 * 1024;
+    const static inline QByteArray schemeName = QByteArrayLiteral("largedata");
+};
+
+class FileHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        requestJob->reply("text/plain;charset=utf-8", new QFile(filePath, requestJob));
+    }
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme fileScheme(schemeName);
+        fileScheme.setFlags(QWebEngineUrlScheme::CorsEnabled);
+        QWebEngineUrlScheme::registerScheme(fileScheme);
+    }
+
+    QString filePath;
+    const static inline QByteArray schemeName = QByteArrayLiteral("filereply");
+};
+
+class CachingHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    CachingHandler() { setResponseCacheSize(1024 * 1024); }
+
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        ++requestCount;
+        QMultiMap<QByteArray, QByteArray> headers = { { "Cache-Control", cacheControl } };
+        if (!etag.isEmpty())
+            headers.insert("ETag", etag);
+        requestJob->setAdditionalResponseHeaders(headers);
+        requestJob->reply("text/plain;charset=utf-8", requestJob->requestUrl().toString().toUtf8());
+    }
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme cachingScheme(schemeName);
+        cachingScheme.setFlags(QWebEngineUrlScheme::CorsEnabled);
+        QWebEngineUrlScheme::registerScheme(cachingScheme);
+    }
+
+    int requestCount = 0;
+    QByteArray cacheControl = "max-age=3600";
+    QByteArray etag;
+    const static inline QByteArray schemeName = QByteArrayLiteral("caching");
+};
+
+class ThreadPoolHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    ThreadPoolHandler() { setThreadingMode(ThreadingMode::ThreadPool); }
+
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        QThread *thread = QThread::currentThread();
+        startedOn.storeRelease(thread);
+        QBuffer *buffer = new QBuffer(requestJob);
+        QObject::connect(buffer, &QObject::destroyed, buffer,
+                         [this]() { deletedOn.storeRelease(QThread::currentThread()); },
+                         Qt::DirectConnection);
+        buffer->setData(thread != qApp->thread() ? "worker" : "ui");
+        requestJob->reply("text/plain;charset=utf-8", buffer);
+    }
+
+    QAtomicPointer<QThread> startedOn;
+    QAtomicPointer<QThread> deletedOn;
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme threadPoolScheme(schemeName);
+        QWebEngineUrlScheme::registerScheme(threadPoolScheme);
+    }
+
+    const static inline QByteArray schemeName = QByteArrayLiteral("threadpool");
+};
+
+class StreamingBodyHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        bodySize = 0;
+        QIODevice *requestBodyDevice = requestJob->requestBody();
+        QVERIFY2(requestBodyDevice->open(QIODevice::ReadOnly),
+                 qPrintable(requestBodyDevice->errorString()));
+        if (!requestBodyStreaming()) {
+            // Blocking reads wait for the whole body to be uploaded.
+            bodySize = requestBodyDevice->readAll().size();
+            QVERIFY(requestBodyDevice->atEnd());
+            requestBodyDevice->close();
+            requestJob->reply("text/plain;charset=utf-8", QByteArray::number(bodySize));
+            return;
+        }
+        QPointer<QWebEngineUrlRequestJob> job(requestJob);
+        auto readBody = [this, job, requestBodyDevice]() {
+            if (!job)
+                return;
+            bodySize += requestBodyDevice->readAll().size();
+            if (!requestBodyDevice->atEnd())
+                return;
+            requestBodyDevice->close();
+            job->reply("text/plain;charset=utf-8", QByteArray::number(bodySize));
+        };
+        connect(requestBodyDevice, &QIODevice::readyRead, this, readBody);
+        readBody();
+    }
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme streamingScheme(schemeName);
+        streamingScheme.setFlags(QWebEngineUrlScheme::CorsEnabled
+                                 | QWebEngineUrlScheme::FetchApiAllowed);
+        QWebEngineUrlScheme::registerScheme(streamingScheme);
+    }
+
+    qint64 bodySize = 0;
+    const static inline QByteArray schemeName = QByteArrayLiteral("streamingbody");
+};
+
+class PriorityHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    void requestStarted(QWebEngineUrlRequestJob *requestJob) override
+    {
+        priorities.insert(requestJob->requestUrl().path(), requestJob->priority());
+        if (requestJob->requestUrl().path() == "page") {
+            requestJob->reply("text/html", "<html><head><link rel=stylesheet href=style.css></head>"
+                                           "<body><img src=image.png></body></html>");
+        } else {
+            requestJob->reply("text/plain", "");
+        }
+    }
+
+    static void registerUrlScheme()
+    {
+        QWebEngineUrlScheme priorityScheme(schemeName);
+        QWebEngineUrlScheme::registerScheme(priorityScheme);
+    }
+
+    QMap<QString, QWebEngineUrlRequestJob::Priority> priorities;
+    const static inline QByteArray schemeName = QByteArrayLiteral("priority");
+};
+
 class tst_QWebEngineUrlRequestJob : public QObject
 {
     Q_OBJECT
@@ -168,6 +361,13 @@ private Q_SLOTS:
         AdditionalResponseHeadersHandler::registerUrlScheme();
         RequestBodyHandler::registerUrlScheme();
         SuccessHandler::registerUrlScheme();
+        ThreadPoolHandler::registerUrlScheme();
+        LargeDataHandler::registerUrlScheme();
+        DataHandler::registerUrlScheme();
+        FileHandler::registerUrlScheme();
+        CachingHandler::registerUrlScheme();
+        StreamingBodyHandler::registerUrlScheme();
+        PriorityHandler::registerUrlScheme();
     }
 
     void withAdditionalResponseHeaders_data()
@@ -213,6 +413,82 @@ private Q_SLOTS:
         QCOMPARE(page.comparedMessageCount(), 1);
     }
 
+    void streamingRequestBody()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        StreamingBodyHandler handler;
+        handler.setRequestBodyStreaming(true);
+        profile.installUrlSchemeHandler(StreamingBodyHandler::schemeName, &handler);
+
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+        page.load(QUrl("streamingbody:page"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+        QCOMPARE(toPlainTextSync(&page), "0");
+
+        // A Blob is uploaded through a data pipe, which arrives in several reads.
+        page.runJavaScript("window.result = null;"
+                           "fetch('streamingbody:upload', { method: 'POST',"
+                           "    body: new Blob([new Uint8Array(4 * 1024 * 1024)]) })"
+                           "    .then(response => response.text())"
+                           "    .then(text => window.result = text);");
+        QTRY_COMPARE(evaluateJavaScriptSync(&page, "window.result").toString(),
+                     QString::number(4 * 1024 * 1024));
+        QCOMPARE(handler.bodySize, qint64(4 * 1024 * 1024));
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
+    void blockingRequestBody()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        StreamingBodyHandler handler;
+        QVERIFY(!handler.requestBodyStreaming());
+        profile.installUrlSchemeHandler(StreamingBodyHandler::schemeName, &handler);
+
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+        page.load(QUrl("streamingbody:page"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+
+        // Without streaming, a single read returns the whole Blob.
+        page.runJavaScript("window.result = null;"
+                           "fetch('streamingbody:upload', { method: 'POST',"
+                           "    body: new Blob([new Uint8Array(4 * 1024 * 1024)]) })"
+                           "    .then(response => response.text())"
+                           "    .then(text => window.result = text);");
+        QTRY_COMPARE(evaluateJavaScriptSync(&page, "window.result").toString(),
+                     QString::number(4 * 1024 * 1024));
+        QCOMPARE(handler.bodySize, qint64(4 * 1024 * 1024));
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
+    void requestPriority()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        PriorityHandler handler;
+        QVERIFY(!handler.prioritizedScheduling());
+        handler.setPrioritizedScheduling(true);
+        QVERIFY(handler.prioritizedScheduling());
+        profile.installUrlSchemeHandler(PriorityHandler::schemeName, &handler);
+
+        page.load(QUrl("priority:page"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QTRY_COMPARE(handler.priorities.size(), 3);
+        QCOMPARE(handler.priorities.value("page"), QWebEngineUrlRequestJob::Priority::Highest);
+        QCOMPARE(handler.priorities.value("style.css"),
+                 QWebEngineUrlRequestJob::Priority::Highest);
+        QVERIFY(handler.priorities.value("image.png") < QWebEngineUrlRequestJob::Priority::Medium);
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
     void notifySuccess()
     {
         QWebEngineProfile profile;
@@ -236,6 +512,315 @@ private Q_SLOTS:
         // The content of the page did not change
         QCOMPARE(toPlainTextSync(&page), "success://one");
     }
+
+    void threadPoolHandler()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        ThreadPoolHandler handler;
+        QCOMPARE(handler.threadingMode(), QWebEngineUrlSchemeHandler::ThreadingMode::ThreadPool);
+        profile.installUrlSchemeHandler(ThreadPoolHandler::schemeName, &handler);
+
+        page.load(QUrl("threadpool://one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+        QCOMPARE(toPlainTextSync(&page), "worker");
+
+        // The job and its reply device are deleted on the thread they were created on.
+        QTRY_VERIFY(handler.deletedOn.loadAcquire());
+        QCOMPARE(handler.deletedOn.loadAcquire(), handler.startedOn.loadAcquire());
+
+        profile.removeUrlSchemeHandler(&handler);
+
+        // Once removed, the handler is not called from worker threads anymore.
+        handler.startedOn.storeRelease(nullptr);
+        page.load(QUrl("threadpool://two"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 2);
+        QVERIFY(!loadFinishedSpy.at(1).first().toBool());
+        QVERIFY(!handler.startedOn.loadAcquire());
+    }
+
+    void replyWithData()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        DataHandler handler;
+        profile.installUrlSchemeHandler(DataHandler::schemeName, &handler);
+
+        page.load(QUrl("datareply://one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+        QCOMPARE(toPlainTextSync(&page), "datareply://one");
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
+    void replyWithDataRange()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        LargeDataHandler handler;
+        profile.installUrlSchemeHandler(LargeDataHandler::schemeName, &handler);
+
+        page.load(QUrl("largedata:page"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+
+        // The range is larger than the data pipe, so it is written in several
+        // steps, none of which may go past its end.
+        const qint64 first = 1000;
+        const qint64 last = first + 3 * 1024 * 1024 - 1;
+        const QVariantList result = evaluateJavaScriptSync(
+                &page,
+                QStringLiteral("var request = new XMLHttpRequest();"
+                               "request.open('GET', 'largedata:data', false);"
+                               "request.setRequestHeader('Range', 'bytes=%1-%2');"
+                               "request.send();"
+                               "[request.status, request.responseText.length,"
+                               " request.responseText.substr(0, 26),"
+                               " request.responseText.substr(-26)]")
+                        .arg(first).arg(last)).toList();
+        QCOMPARE(result.size(), 4);
+        const QByteArray body = LargeDataHandler::body();
+        QCOMPARE(result.at(0).toInt(), 206);
+        QCOMPARE(result.at(1).toLongLong(), last - first + 1);
+        QCOMPARE(result.at(2).toString(), QString::fromLatin1(body.mid(first, 26)));
+        QCOMPARE(result.at(3).toString(), QString::fromLatin1(body.mid(last - 25, 26)));
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
+    // Resources are served by the built-in handler of the qrc scheme.
+    void qrcCompressedResource()
+    {
+        QResource resource(":/qrcCompressed.txt");
+        QVERIFY(resource.isValid());
+        QVERIFY(resource.compressionAlgorithm() != QResource::NoCompression);
+        const QByteArray expected = resource.uncompressedData();
+
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+        page.load(QUrl("qrc:/qrcUncompressed.txt"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+
+        // The second request is answered from the data decompressed for the first.
+        for (int i = 0; i < 2; ++i) {
+            const QVariantList result = evaluateJavaScriptSync(
+                    &page,
+                    QStringLiteral("var request = new XMLHttpRequest();"
+                                   "request.open('GET', 'qrc:/qrcCompressed.txt', false);"
+                                   "request.send();"
+                                   "[request.status, request.responseText]")).toList();
+            QCOMPARE(result.size(), 2);
+            QCOMPARE(result.at(0).toInt(), 200);
+            QCOMPARE(result.at(1).toString(), QString::fromLatin1(expected));
+        }
+    }
+
+    void qrcUncompressedResourceRange()
+    {
+        QResource resource(":/qrcUncompressed.txt");
+        QVERIFY(resource.isValid());
+        QVERIFY(resource.compressionAlgorithm() == QResource::NoCompression);
+        const QByteArray data(reinterpret_cast<const char *>(resource.data()), resource.size());
+
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+        page.load(QUrl("qrc:/qrcUncompressed.txt"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+
+        const qint64 first = 100;
+        const qint64 last = 1099;
+        const QVariantList result = evaluateJavaScriptSync(
+                &page,
+                QStringLiteral("var request = new XMLHttpRequest();"
+                               "request.open('GET', 'qrc:/qrcUncompressed.txt', false);"
+                               "request.setRequestHeader('Range', 'bytes=%1-%2');"
+                               "request.send();"
+                               "[request.status, request.responseText]")
+                        .arg(first).arg(last)).toList();
+        QCOMPARE(result.size(), 2);
+        QCOMPARE(result.at(0).toInt(), 206);
+        QCOMPARE(result.at(1).toString(), QString::fromLatin1(data.mid(first, last - first + 1)));
+    }
+
+    // Replies of uncompressed resources point into the resource data, which
+    // has to outlive the request when the resource file is unregistered.
+    void qrcUnregisterWhileLoading()
+    {
+        const QString rccFile = QStringLiteral(QT_TESTCASE_BUILDDIR "/dynamic.rcc");
+        QVERIFY(QResource::registerResource(rccFile, "/dynamic"));
+
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadProgressSpy(&page, SIGNAL(loadProgress(int)));
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+        page.load(QUrl("qrc:/dynamic/large.txt"));
+        // Progress beyond the initial value means the reply has started.
+        QTRY_VERIFY(!loadProgressSpy.isEmpty() && loadProgressSpy.last().first().toInt() > 10);
+        QVERIFY(QResource::unregisterResource(rccFile, "/dynamic"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+
+        // The page is still alive, and the resource is gone for new requests.
+        QCOMPARE(evaluateJavaScriptSync(&page, "1 + 1").toInt(), 2);
+        page.load(QUrl("qrc:/dynamic/large.txt"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 2);
+        QVERIFY(!loadFinishedSpy.at(1).first().toBool());
+    }
+
+    void replyWithFile()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        QFile file(dir.filePath("content.txt"));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("0123456789");
+        file.close();
+
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        FileHandler handler;
+        handler.filePath = file.fileName();
+        profile.installUrlSchemeHandler(FileHandler::schemeName, &handler);
+
+        page.load(QUrl("filereply:content"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QVERIFY(loadFinishedSpy.at(0).first().toBool());
+        QCOMPARE(toPlainTextSync(&page), "0123456789");
+
+        // Byte ranges are served from the middle of the file.
+        const QString range = evaluateJavaScriptSync(
+                &page,
+                "var request = new XMLHttpRequest();"
+                "request.open('GET', 'filereply:content', false);"
+                "request.setRequestHeader('Range', 'bytes=2-5');"
+                "request.send();"
+                "request.status + ' ' + request.responseText").toString();
+        QCOMPARE(range, "206 2345");
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
+    void responseCache()
+    {
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        CachingHandler handler;
+        QCOMPARE(handler.responseCacheSize(), qint64(1024 * 1024));
+        profile.installUrlSchemeHandler(CachingHandler::schemeName, &handler);
+
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QCOMPARE(handler.requestCount, 1);
+
+        // Served from the cache without reaching the handler.
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 2);
+        QVERIFY(loadFinishedSpy.at(1).first().toBool());
+        QCOMPARE(toPlainTextSync(&page), "caching:one");
+        QCOMPARE(handler.requestCount, 1);
+
+        handler.clearResponseCache();
+        handler.cacheControl = "no-store";
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 3);
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 4);
+        QCOMPARE(handler.requestCount, 3);
+
+        handler.setResponseCacheSize(0);
+        QCOMPARE(handler.responseCacheSize(), qint64(0));
+        profile.removeUrlSchemeHandler(&handler);
+    }
+
+    void responseCachePerProfile()
+    {
+        CachingHandler handler;
+        QWebEngineProfile profile;
+        QWebEngineProfile otherProfile;
+        profile.installUrlSchemeHandler(CachingHandler::schemeName, &handler);
+        otherProfile.installUrlSchemeHandler(CachingHandler::schemeName, &handler);
+
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+        QWebEnginePage otherPage(&otherProfile);
+        QSignalSpy otherLoadFinishedSpy(&otherPage, SIGNAL(loadFinished(bool)));
+
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QCOMPARE(handler.requestCount, 1);
+
+        // Responses cached for one profile are not served to another.
+        otherPage.load(QUrl("caching:one"));
+        QTRY_COMPARE(otherLoadFinishedSpy.size(), 1);
+        QCOMPARE(handler.requestCount, 2);
+
+        // Clearing the HTTP cache of a profile drops its responses only.
+        profile.clearHttpCache();
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 2);
+        QCOMPARE(handler.requestCount, 3);
+        otherPage.load(QUrl("caching:one"));
+        QTRY_COMPARE(otherLoadFinishedSpy.size(), 2);
+        QCOMPARE(handler.requestCount, 3);
+
+        profile.removeUrlSchemeHandler(&handler);
+        otherProfile.removeUrlSchemeHandler(&handler);
+    }
+
+    void responseCacheETag_data()
+    {
+        QTest::addColumn<QString>("ifNoneMatch");
+        QTest::addColumn<int>("status");
+        QTest::newRow("same case") << "\"AbC-123\"" << 304;
+        QTest::newRow("lowercase") << "\"abc-123\"" << 304;
+        QTest::newRow("weak") << "W/\"AbC-123\"" << 304;
+        QTest::newRow("other") << "\"AbC-124\"" << 200;
+    }
+
+    void responseCacheETag()
+    {
+        QFETCH(QString, ifNoneMatch);
+        QFETCH(int, status);
+
+        QWebEngineProfile profile;
+        QWebEnginePage page(&profile);
+        QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+
+        CachingHandler handler;
+        handler.etag = "\"AbC-123\"";
+        profile.installUrlSchemeHandler(CachingHandler::schemeName, &handler);
+
+        page.load(QUrl("caching:one"));
+        QTRY_COMPARE(loadFinishedSpy.size(), 1);
+        QCOMPARE(handler.requestCount, 1);
+
+        const int result = evaluateJavaScriptSync(
+                &page,
+                QStringLiteral("var request = new XMLHttpRequest();"
+                               "request.open('GET', 'caching:one', false);"
+                               "request.setRequestHeader('If-None-Match', '%1');"
+                               "request.send();"
+                               "request.status").arg(ifNoneMatch)).toInt();
+        QCOMPARE(result, status);
+        QCOMPARE(handler.requestCount, 1);
+
+        profile.removeUrlSchemeHandler(&handler);
+    }
 };
 
 QTEST_MAIN(tst_QWebEngineUrlRequestJob)
@@ -20,6 +20,7 @@
 #include <QtWebEngineCore/QWebEngineQuotaRequest>
 #include <QtWebEngineCore/QWebEngineRegisterProtocolHandlerRequest>
 #include <QtWebEngineCore/QWebEngineClientHints>
+#include <QtWebEngineCore/QWebEngineCompositorStatistics>
 #include <QtWebEngineCore/QWebEngineContextMenuRequest>
 #include <QtWebEngineCore/QWebEngineDownloadRequest>
 #include <QtWebEngineCore/QWebEngineScript>
@@ -83,6 +84,7 @@ static const QList<const QMetaObject *> typesToCheck = QList<const QMetaObject *
     << &QWebEngineWebAuthPinRequest::staticMetaObject
     << &QWebEngineFrame::staticMetaObject
     << &QWebEngineClientHints::staticMetaObject
+    << &QWebEngineCompositorStatistics::staticMetaObject
     << &QQuickWebEngineProfilePrototype::staticMetaObject
     ;
 
@@ -172,6 +174,12 @@ static const QStringList expectedAPI = QStringList()
     << "QQuickWebEngineClientCertificateSelection.selectNone() --> void"
     << "QQuickWebEngineColorDialogRequest.accepted --> bool"
     << "QQuickWebEngineColorDialogRequest.color --> QColor"
+    << "QWebEngineCompositorStatistics.averagePresentLatency --> qlonglong"
+    << "QWebEngineCompositorStatistics.damagedPixelArea --> qulonglong"
+    << "QWebEngineCompositorStatistics.framesDropped --> qulonglong"
+    << "QWebEngineCompositorStatistics.framesPresented --> qulonglong"
+    << "QWebEngineCompositorStatistics.framesProduced --> qulonglong"
+    << "QWebEngineCompositorStatistics.maximumPresentLatency --> qlonglong"
     << "QWebEngineContextMenuRequest.CanUndo --> EditFlags"
     << "QWebEngineContextMenuRequest.CanRedo --> EditFlags"
     << "QWebEngineContextMenuRequest.CanCut --> EditFlags"
@@ -774,6 +782,7 @@ static const QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.colorDialogRequested(QQuickWebEngineColorDialogRequest*) --> void"
     << "QQuickWebEngineView.contentsSize --> QSizeF"
     << "QQuickWebEngineView.contentsSizeChanged(QSizeF) --> void"
+    << "QQuickWebEngineView.compositorStatistics() --> QWebEngineCompositorStatistics"
     << "QQuickWebEngineView.contextMenuRequested(QWebEngineContextMenuRequest*) --> void"
     << "QQuickWebEngineView.desktopMediaRequested(QWebEngineDesktopMediaRequest) --> void"
     << "QQuickWebEngineView.devToolsId --> QString"
@@ -815,6 +824,8 @@ static const QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.loading --> bool"
     << "QQuickWebEngineView.loadingChanged(QWebEngineLoadingInfo) --> void"
     << "QQuickWebEngineView.mainFrame --> QWebEngineFrame"
+    << "QQuickWebEngineView.maximumFrameRate --> int"
+    << "QQuickWebEngineView.maximumFrameRateChanged(int) --> void"
     << "QQuickWebEngineView.navigationRequested(QWebEngineNavigationRequest*) --> void"
     << "QQuickWebEngineView.newWindowRequested(QQuickWebEngineNewWindowRequest*) --> void"
     << "QQuickWebEngineView.AcceptRequest --> NavigationRequestAction"
@@ -854,6 +865,7 @@ static const QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.reloadAndBypassCache() --> void"
     << "QQuickWebEngineView.renderProcessTerminated(QQuickWebEngineView::RenderProcessTerminationStatus,int) --> void"
     << "QQuickWebEngineView.replaceMisspelledWord(QString) --> void"
+    << "QQuickWebEngineView.resetCompositorStatistics() --> void"
     << "QQuickWebEngineView.runJavaScript(QString) --> void"
     << "QQuickWebEngineView.runJavaScript(QString,QJSValue) --> void"
     << "QQuickWebEngineView.runJavaScript(QString,uint) --> void"
@@ -0,0 +1,120 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <quickutil.h>
+#include <QtTest/QtTest>
+#include <QQuickItem>
+#include <QQuickView>
+#include <QSGImageNode>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QtWebEngineQuick/qtwebenginequickglobal.h>
+
+// Runs with GPU acceleration disabled, so the software compositor hands its
+// frames to the RHI scene graph, and with the basic render loop, so the scene
+// graph can be inspected from the test.
+class tst_QQuickWebEngineViewSoftwareCompositor : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void persistentTexture();
+};
+
+// Four squares of 100x100 pixels, with ids matching their positions.
+static const char quadrantsHtml[] =
+        "<html><body style='margin: 0'>"
+        "<div id=topLeft style='position: absolute; left: 0; top: 0; width: 100px; "
+        "height: 100px; background: #ff0000'></div>"
+        "<div id=topRight style='position: absolute; left: 100px; top: 0; width: 100px; "
+        "height: 100px; background: #00ff00'></div>"
+        "<div id=bottomLeft style='position: absolute; left: 0; top: 100px; width: 100px; "
+        "height: 100px; background: #0000ff'></div>"
+        "<div id=bottomRight style='position: absolute; left: 100px; top: 100px; width: 100px; "
+        "height: 100px; background: #ffff00'></div>"
+        "</body></html>";
+
+// Returns the image node of the item that displays web content.
+static QSGImageNode *contentNode(QQuickItem *item)
+{
+    QSGNode *node = QQuickItemPrivate::get(item)->paintNode;
+    if (node && node->type() == QSGNode::GeometryNodeType)
+        return static_cast<QSGImageNode *>(node);
+    const QList<QQuickItem *> children = item->childItems();
+    for (QQuickItem *child : children) {
+        if (QSGImageNode *childNode = contentNode(child))
+            return childNode;
+    }
+    return nullptr;
+}
+
+static QColor colorAt(QQuickWindow *window, const QPoint &point)
+{
+    const QImage image = window->grabWindow();
+    return image.pixelColor((QPointF(point) * image.devicePixelRatio()).toPoint());
+}
+
+void tst_QQuickWebEngineViewSoftwareCompositor::persistentTexture()
+{
+    QQuickView view;
+    view.setResizeMode(QQuickView::SizeRootObjectToView);
+    view.setSource(QUrl(QStringLiteral("data:text/plain,import QtQuick; import QtWebEngine; "
+                                       "Item { WebEngineView { anchors.fill: parent } }")));
+    view.resize(200, 200);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    // The software compositor only keeps its texture across frames with an RHI.
+    QVERIFY(view.rhi());
+
+    QQuickWebEngineView *webEngineView =
+            static_cast<QQuickWebEngineView *>(view.rootObject()->childItems().first());
+    webEngineView->loadHtml(QString::fromLatin1(quadrantsHtml));
+    QVERIFY(waitForLoadSucceeded(webEngineView));
+
+    const QPoint topLeft(50, 50), topRight(150, 50), bottomLeft(50, 150), bottomRight(150, 150);
+    QTRY_COMPARE(colorAt(&view, topLeft), QColor(0xff, 0, 0));
+    QCOMPARE(colorAt(&view, topRight), QColor(0, 0xff, 0));
+    QCOMPARE(colorAt(&view, bottomLeft), QColor(0, 0, 0xff));
+    QCOMPARE(colorAt(&view, bottomRight), QColor(0xff, 0xff, 0));
+
+    QSGImageNode *node = contentNode(webEngineView);
+    QVERIFY(node);
+    QSGTexture *texture = node->texture();
+    QVERIFY(texture);
+
+    // Only the damaged square is uploaded into the texture, the others have
+    // to keep the pixels uploaded for the previous frames.
+    evaluateJavaScriptSync(webEngineView,
+                           "document.getElementById('topLeft').style.background = '#000000'");
+    QTRY_COMPARE(colorAt(&view, topLeft), QColor(0, 0, 0));
+    QCOMPARE(colorAt(&view, topRight), QColor(0, 0xff, 0));
+    QCOMPARE(colorAt(&view, bottomLeft), QColor(0, 0, 0xff));
+    QCOMPARE(colorAt(&view, bottomRight), QColor(0xff, 0xff, 0));
+
+    evaluateJavaScriptSync(webEngineView,
+                           "document.getElementById('bottomRight').style.background = '#ffffff'");
+    QTRY_COMPARE(colorAt(&view, bottomRight), QColor(0xff, 0xff, 0xff));
+    QCOMPARE(colorAt(&view, topLeft), QColor(0, 0, 0));
+    QCOMPARE(colorAt(&view, topRight), QColor(0, 0xff, 0));
+    QCOMPARE(colorAt(&view, bottomLeft), QColor(0, 0, 0xff));
+
+    // The frames were shown by updating the texture of the same node in place.
+    QCOMPARE(contentNode(webEngineView), node);
+    QCOMPARE(node->texture(), texture);
+}
+
+int main(int argc, char *argv[])
+{
+    qputenv("QSG_RENDER_LOOP", "basic");
+    QtWebEngineQuick::initialize();
+    QList<const char *> w_argv(argv, argv + argc);
+    w_argv.append("--webEngineArgs");
+    w_argv.append("--disable-gpu");
+    int w_argc = w_argv.size();
+
+    QGuiApplication app(w_argc, const_cast<char **>(w_argv.data()));
+    app.setAttribute(Qt::AA_Use96Dpi, true);
+    tst_QQuickWebEngineViewSoftwareCompositor tc;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_qquickwebengineviewsoftwarecompositor.moc"
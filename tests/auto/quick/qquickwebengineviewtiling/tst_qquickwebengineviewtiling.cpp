@@ -0,0 +1,90 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <quickutil.h>
+#include <QtTest/QtTest>
+#include <QQuickItem>
+#include <QQuickView>
+#include <QSGImageNode>
+#include <QtGui/private/qrhi_p.h>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QtWebEngineQuick/qtwebenginequickglobal.h>
+
+// Runs with GPU acceleration disabled, so the software compositor hands its
+// frames to the RHI scene graph, and with the basic render loop, so the scene
+// graph can be inspected from the test.
+class tst_QQuickWebEngineViewTiling : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void tilesCoverLargeView();
+};
+
+// Returns the union of the tile rects below the node of the item that
+// displays web content, or an empty rect if the content is not tiled.
+static QRectF tiledRect(QQuickItem *item, int *tileCount)
+{
+    QSGNode *node = QQuickItemPrivate::get(item)->paintNode;
+    if (node && node->type() == QSGNode::BasicNodeType && node->childCount() > 1) {
+        QRectF rect;
+        for (QSGNode *child = node->firstChild(); child; child = child->nextSibling())
+            rect |= static_cast<QSGImageNode *>(child)->rect();
+        *tileCount = node->childCount();
+        return rect;
+    }
+    const QList<QQuickItem *> children = item->childItems();
+    for (QQuickItem *child : children) {
+        const QRectF rect = tiledRect(child, tileCount);
+        if (!rect.isEmpty())
+            return rect;
+    }
+    return QRectF();
+}
+
+void tst_QQuickWebEngineViewTiling::tilesCoverLargeView()
+{
+    QQuickView view;
+    view.setResizeMode(QQuickView::SizeRootObjectToView);
+    view.setSource(QUrl(QStringLiteral(
+            "data:text/plain,import QtQuick; import QtWebEngine; Item { WebEngineView { } }")));
+    view.resize(300, 100);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QVERIFY(view.rhi());
+
+    // Wider than any texture, while the window itself stays small.
+    const int maximumTextureSize = view.rhi()->resourceLimit(QRhi::TextureSizeMax);
+    QQuickWebEngineView *webEngineView =
+            static_cast<QQuickWebEngineView *>(view.rootObject()->childItems().first());
+    webEngineView->setSize(QSizeF(maximumTextureSize + 100, 64));
+    webEngineView->loadHtml("<html><body style='background: green'></body></html>");
+    QVERIFY(waitForLoadSucceeded(webEngineView));
+
+    int tileCount = 0;
+    QRectF covered;
+    QTRY_VERIFY_WITH_TIMEOUT(
+            !(covered = tiledRect(webEngineView, &tileCount)).isEmpty()
+                    && covered.width() >= webEngineView->width(), 10000);
+    QVERIFY(tileCount > 1);
+    QCOMPARE(covered.topLeft(), QPointF(0, 0));
+    QCOMPARE(covered.width(), webEngineView->width());
+    QCOMPARE(covered.height(), webEngineView->height());
+}
+
+int main(int argc, char *argv[])
+{
+    qputenv("QSG_RENDER_LOOP", "basic");
+    QtWebEngineQuick::initialize();
+    QList<const char *> w_argv(argv, argv + argc);
+    w_argv.append("--webEngineArgs");
+    w_argv.append("--disable-gpu");
+    int w_argc = w_argv.size();
+
+    QGuiApplication app(w_argc, const_cast<char **>(w_argv.data()));
+    app.setAttribute(Qt::AA_Use96Dpi, true);
+    tst_QQuickWebEngineViewTiling tc;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_qquickwebengineviewtiling.moc"
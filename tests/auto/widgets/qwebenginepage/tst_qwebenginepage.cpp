@@ -50,6 +50,8 @@
 #endif
 #include <httpserver.h>
 #include <qwebengineclienthints.h>
+#include <qwebenginecompositorstatistics.h>
+#include <qwebenginenetworkrequestrecord.h>
 #include <qwebenginedownloadrequest.h>
 #include <qwebenginedesktopmediarequest.h>
 #include <qwebenginefilesystemaccessrequest.h>
@@ -268,6 +270,11 @@ private Q_SLOTS:
     void openNewTabInDifferentProfile();
     void renderProcessCrashed();
     void renderProcessPid();
+    void compositorStatistics();
+    void networkRequestLog();
+    void networkRequestLogDeniedFile();
+    void maximumFrameRate();
+    void maximumFrameRateInterval();
     void backgroundColor();
     void popupOnTransparentBackground();
     void audioMuted();
@@ -5119,6 +5126,159 @@ void tst_QWebEnginePage::renderProcessPid()
     QCOMPARE(m_page->renderProcessPid(), 0);
 }
 
+void tst_QWebEnginePage::compositorStatistics()
+{
+    QWebEngineView view;
+    view.resize(300, 300);
+    QWebEnginePage &page = *view.page();
+    QCOMPARE(page.compositorStatistics().framesProduced(), quint64(0));
+
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.setHtml("<html><body style='background: red'></body></html>");
+    QVERIFY(spyFinished.wait());
+
+    QTRY_VERIFY(page.compositorStatistics().framesPresented() > 0);
+    QWebEngineCompositorStatistics statistics = page.compositorStatistics();
+    QVERIFY(statistics.framesProduced() >= statistics.framesPresented());
+    QVERIFY(statistics.damagedPixelArea() > 0);
+    QVERIFY(statistics.maximumPresentLatency() >= statistics.averagePresentLatency());
+
+    page.resetCompositorStatistics();
+    statistics = page.compositorStatistics();
+    QCOMPARE(statistics.framesPresented(), quint64(0));
+    QCOMPARE(statistics.damagedPixelArea(), quint64(0));
+}
+
+class BlockingInterceptor : public QWebEngineUrlRequestInterceptor
+{
+public:
+    void interceptRequest(QWebEngineUrlRequestInfo &info) override
+    {
+        if (info.requestUrl().path() == "/blocked.js")
+            info.block(true);
+    }
+};
+
+void tst_QWebEnginePage::networkRequestLog()
+{
+    const QByteArray script = "var loaded = true;";
+    HttpServer server;
+    connect(&server, &HttpServer::newRequest, [&](HttpReqRep *rr) {
+        if (rr->requestPath() == "/index.html") {
+            rr->setResponseBody("<html><head>"
+                                "<script src='a.js'></script><script src='b.js'></script>"
+                                "<script src='c.js'></script><script src='blocked.js'></script>"
+                                "</head><body></body></html>");
+            rr->setResponseHeader("Content-Type", "text/html");
+        } else {
+            rr->setResponseBody(script);
+            rr->setResponseHeader("Content-Type", "text/javascript");
+        }
+        rr->sendResponse();
+    });
+    QVERIFY(server.start());
+
+    BlockingInterceptor interceptor;
+    QWebEnginePage page;
+    page.setUrlRequestInterceptor(&interceptor);
+    QList<QList<QWebEngineNetworkRequestRecord>> batches;
+    connect(&page, &QWebEnginePage::networkRequestsFinished,
+            [&](const QList<QWebEngineNetworkRequestRecord> &records) { batches.append(records); });
+    page.startNetworkRequestLog();
+
+    const QList<QUrl> expectedUrls = { server.url("/index.html"), server.url("/a.js"),
+                                       server.url("/b.js"), server.url("/c.js") };
+    QHash<QUrl, QWebEngineNetworkRequestRecord> records;
+    auto collect = [&]() {
+        for (const auto &batch : std::as_const(batches)) {
+            for (const QWebEngineNetworkRequestRecord &record : batch)
+                records.insert(record.url(), record);
+        }
+        return records.size();
+    };
+
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.load(server.url("/index.html"));
+    QVERIFY(spyFinished.wait());
+    QTRY_VERIFY(collect() > expectedUrls.size()
+                && std::all_of(expectedUrls.begin(), expectedUrls.end(),
+                               [&](const QUrl &url) { return records.contains(url); })
+                && records.contains(server.url("/blocked.js")));
+    // Requests finishing close together arrive together.
+    QVERIFY(batches.size() < expectedUrls.size());
+
+    for (const QUrl &url : expectedUrls) {
+        const QWebEngineNetworkRequestRecord record = records.value(url);
+        QCOMPARE(record.statusCode(), 200);
+        QCOMPARE(record.error(), 0);
+        QVERIFY(record.timeToFirstByte() >= 0);
+        QVERIFY(record.totalDuration() >= record.timeToFirstByte());
+        QVERIFY(record.encodedDataLength() > 0);
+        if (url.path() == "/index.html") {
+            QCOMPARE(record.resourceType(), QWebEngineUrlRequestInfo::ResourceTypeMainFrame);
+        } else {
+            QCOMPARE(record.resourceType(), QWebEngineUrlRequestInfo::ResourceTypeScript);
+            QCOMPARE(record.decodedBodyLength(), qint64(script.size()));
+            QCOMPARE(record.initiator().host(), server.url().host());
+        }
+    }
+
+    // Requests blocked before reaching the network are logged with their error.
+    const QWebEngineNetworkRequestRecord blocked = records.value(server.url("/blocked.js"));
+    QCOMPARE(blocked.error(), -10); // net::ERR_ACCESS_DENIED
+    QCOMPARE(blocked.statusCode(), 0);
+    QCOMPARE(blocked.resourceType(), QWebEngineUrlRequestInfo::ResourceTypeScript);
+    QCOMPARE(blocked.encodedDataLength(), qint64(0));
+
+    page.stopNetworkRequestLog();
+    batches.clear();
+    page.load(server.url("/index.html"));
+    QVERIFY(spyFinished.wait());
+    QTest::qWait(600);
+    QVERIFY(batches.isEmpty());
+}
+
+void tst_QWebEnginePage::networkRequestLogDeniedFile()
+{
+    QTemporaryDir tempDir(QDir::tempPath() + "/tst_qwebenginepage-XXXXXX");
+    QVERIFY(tempDir.isValid());
+    QFile script(tempDir.filePath("script.js"));
+    QVERIFY(script.open(QIODevice::WriteOnly));
+    script.write("var loaded = true;");
+    script.close();
+    QFile index(tempDir.filePath("index.html"));
+    QVERIFY(index.open(QIODevice::WriteOnly));
+    index.write("<html><head><script src='script.js'></script></head><body></body></html>");
+    index.close();
+
+    QWebEnginePage page;
+    page.settings()->setAttribute(QWebEngineSettings::LocalContentCanAccessFileUrls, false);
+    QList<QWebEngineNetworkRequestRecord> records;
+    connect(&page, &QWebEnginePage::networkRequestsFinished,
+            [&](const QList<QWebEngineNetworkRequestRecord> &batch) { records.append(batch); });
+    page.startNetworkRequestLog();
+
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.load(QUrl::fromLocalFile(index.fileName()));
+    QVERIFY(spyFinished.wait());
+    QCOMPARE(evaluateJavaScriptSync(&page, "typeof loaded"), QVariant(QStringLiteral("undefined")));
+
+    // The file: subresource is denied before it reaches the network, and still logged.
+    const QUrl scriptUrl = QUrl::fromLocalFile(script.fileName());
+    auto findScript = [&]() {
+        return std::find_if(records.cbegin(), records.cend(),
+                            [&](const QWebEngineNetworkRequestRecord &record) {
+                                return record.url() == scriptUrl;
+                            });
+    };
+    QTRY_VERIFY(findScript() != records.cend());
+    QCOMPARE(findScript()->error(), -10); // net::ERR_ACCESS_DENIED
+    QCOMPARE(findScript()->resourceType(), QWebEngineUrlRequestInfo::ResourceTypeScript);
+    page.stopNetworkRequestLog();
+}
+
 class FileSelectionTestPage : public QWebEnginePage {
 public:
     FileSelectionTestPage() : m_tempDir(QDir::tempPath() + "/tst_qwebenginepage-XXXXXX") { }
@@ -5336,6 +5496,74 @@ void tst_QWebEnginePage::audioMuted()
     QCOMPARE(spy[1][0], QVariant(false));
 }
 
+void tst_QWebEnginePage::maximumFrameRate()
+{
+    QWebEngineProfile profile;
+    QWebEnginePage page(&profile);
+    QSignalSpy spy(&page, &QWebEnginePage::maximumFrameRateChanged);
+
+    QCOMPARE(page.maximumFrameRate(), 0);
+    page.setMaximumFrameRate(30);
+    loadSync(&page, QUrl("about:blank"));
+    QCOMPARE(page.maximumFrameRate(), 30);
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy[0][0], QVariant(30));
+    page.setMaximumFrameRate(30);
+    QCOMPARE(spy.size(), 1);
+    page.setMaximumFrameRate(-1);
+    QCOMPARE(page.maximumFrameRate(), 0);
+    QCOMPARE(spy.size(), 2);
+    QCOMPARE(spy[1][0], QVariant(0));
+}
+
+void tst_QWebEnginePage::maximumFrameRateInterval()
+{
+    QWebEngineView view;
+    view.resize(300, 300);
+    QWebEnginePage &page = *view.page();
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.setHtml("<html><body></body></html>");
+    QVERIFY(spyFinished.wait());
+
+    // Median interval in milliseconds between animation frames of the page,
+    // or -1 if the page did not produce enough frames.
+    auto frameInterval = [&page]() {
+        evaluateJavaScriptSync(&page,
+                               "window.intervals = []; (function() {"
+                               "  let last = 0;"
+                               "  function tick(time) {"
+                               "    if (last) intervals.push(time - last);"
+                               "    last = time;"
+                               "    if (intervals.length < 21) requestAnimationFrame(tick);"
+                               "  }"
+                               "  requestAnimationFrame(tick);"
+                               "})();");
+        if (!QTest::qWaitFor([&page]() {
+                return evaluateJavaScriptSync(&page, "intervals.length").toInt() == 21;
+            }, 10000))
+            return -1.0;
+        return evaluateJavaScriptSync(&page,
+                                      "intervals.sort((a, b) => a - b)[10]").toDouble();
+    };
+
+    const qreal refreshRate = view.screen()->refreshRate() > 0 ? view.screen()->refreshRate() : 60;
+    const double displayInterval = 1000 / refreshRate;
+
+    page.setMaximumFrameRate(10);
+    QVERIFY(frameInterval() > 80);
+
+    // A rate above the refresh rate does not make frames faster than the screen.
+    page.setMaximumFrameRate(1000);
+    QVERIFY(frameInterval() > displayInterval * 0.8);
+
+    page.setMaximumFrameRate(0);
+    const double interval = frameInterval();
+    QVERIFY(interval > displayInterval * 0.8);
+    QVERIFY(interval < 80);
+}
+
 void tst_QWebEnginePage::closeContents()
 {
     TestPage page;
@@ -0,0 +1,177 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QApplication>
+#include <QQuickWindow>
+#include <QSignalSpy>
+#include <QTest>
+#include <QWebEngineCapturedFrame>
+#include <QWebEnginePage>
+#include <QWebEngineView>
+
+// Runs with GPU acceleration disabled and the Qt Quick software adaptation,
+// so pages are always drawn by the software compositor, and with views that
+// paint the frames directly into their backing store.
+class tst_SoftwareCompositor : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void frameCapture();
+    void rasterWidget();
+    void bufferRing();
+};
+
+void tst_SoftwareCompositor::frameCapture()
+{
+    QWebEngineView view;
+    view.resize(300, 300);
+    QWebEnginePage &page = *view.page();
+    QList<QWebEngineCapturedFrame> frames;
+    connect(&page, &QWebEnginePage::frameCaptured,
+            [&](const QWebEngineCapturedFrame &frame) { frames.append(frame); });
+    page.startFrameCapture();
+
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.setHtml("<html><body style='background: red'></body></html>");
+    QVERIFY(spyFinished.wait());
+
+    auto centerPixel = [](const QWebEngineCapturedFrame &frame) {
+        const QImage image = frame.image();
+        return image.pixelColor(image.rect().center());
+    };
+    QTRY_VERIFY(!frames.isEmpty() && centerPixel(frames.last()) == QColor(Qt::red));
+
+    const QWebEngineCapturedFrame &first = frames.first();
+    QVERIFY(!first.isNull());
+    QCOMPARE(first.damage(), QRegion(first.image().rect()));
+    for (qsizetype i = 1; i < frames.size(); ++i) {
+        QVERIFY(frames[i].timestamp() >= frames[i - 1].timestamp());
+        QVERIFY(frames[i].image().rect().contains(frames[i].damage().boundingRect()));
+    }
+
+    // A frame kept by the application is not changed by later frames.
+    const QWebEngineCapturedFrame red = frames.last();
+    page.setHtml("<html><body style='background: blue'></body></html>");
+    QVERIFY(spyFinished.wait());
+    QTRY_VERIFY(centerPixel(frames.last()) == QColor(Qt::blue));
+    QCOMPARE(centerPixel(red), QColor(Qt::red));
+
+    page.stopFrameCapture();
+    frames.clear();
+    page.setHtml("<html><body style='background: green'></body></html>");
+    QVERIFY(spyFinished.wait());
+    QTest::qWait(100);
+    QVERIFY(frames.isEmpty());
+}
+
+void tst_SoftwareCompositor::rasterWidget()
+{
+    QWebEngineView view;
+    view.resize(300, 300);
+    QWebEnginePage &page = *view.page();
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.setHtml("<html><body style='background: red'></body></html>");
+    QVERIFY(spyFinished.wait());
+
+    QWidget *delegate = view.focusProxy();
+    QVERIFY(delegate);
+    QVERIFY(!delegate->inherits("QQuickWidget"));
+
+    auto centerPixel = [&view]() {
+        const QImage image = view.grab().toImage();
+        return image.pixelColor(image.rect().center());
+    };
+    QTRY_COMPARE(centerPixel(), QColor(Qt::red));
+
+    // Frames produced while hidden are picked up when the view is shown again.
+    view.hide();
+    page.setHtml("<html><body style='background: blue'></body></html>");
+    QVERIFY(spyFinished.wait());
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QTRY_COMPARE(centerPixel(), QColor(Qt::blue));
+}
+
+void tst_SoftwareCompositor::bufferRing()
+{
+    // A row of squares, each repainted in its own frame, so that the raster
+    // buffers the frames are painted into are reused several times over.
+    constexpr int squareCount = 6;
+    const QStringList colors = { "#ff0000", "#00ff00", "#0000ff", "#ffff00", "#00ffff", "#ff00ff" };
+    QString html = "<html><body style='margin: 0; background: #808080'>";
+    for (int i = 0; i < squareCount; ++i) {
+        html += QString("<div id=square%1 style='position: absolute; left: %2px; top: 0; "
+                        "width: 100px; height: 100px; background: #808080'></div>")
+                        .arg(i)
+                        .arg(i * 100);
+    }
+    html += "</body></html>";
+
+    QWebEngineView view;
+    view.resize(squareCount * 100, 100);
+    QWebEnginePage &page = *view.page();
+    QList<QWebEngineCapturedFrame> frames;
+    connect(&page, &QWebEnginePage::frameCaptured,
+            [&](const QWebEngineCapturedFrame &frame) { frames.append(frame); });
+    page.startFrameCapture();
+
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSignalSpy spyFinished(&page, &QWebEnginePage::loadFinished);
+    page.setHtml(html);
+    QVERIFY(spyFinished.wait());
+
+    auto squareColor = [](const QImage &image, int square) {
+        const QPointF center(square * 100 + 50, 50);
+        return image.pixelColor((center * image.devicePixelRatio()).toPoint());
+    };
+    auto grab = [&view]() { return view.grab().toImage(); };
+    QTRY_COMPARE(squareColor(grab(), 0), QColor(0x80, 0x80, 0x80));
+    QTRY_VERIFY(!frames.isEmpty());
+    // Kept by the application while all later frames are painted.
+    const QImage kept = frames.last().image();
+    frames.clear();
+
+    for (int i = 0; i < squareCount; ++i) {
+        page.runJavaScript(QString("document.getElementById('square%1').style.background = '%2'")
+                                   .arg(i)
+                                   .arg(colors[i]));
+        QTRY_COMPARE(squareColor(grab(), i), QColor(colors[i]));
+        // Squares painted into other buffers have been brought over.
+        const QImage image = grab();
+        for (int j = 0; j < squareCount; ++j)
+            QCOMPARE(squareColor(image, j), j <= i ? QColor(colors[j]) : QColor(0x80, 0x80, 0x80));
+    }
+
+    QTRY_VERIFY(!frames.isEmpty()
+                && squareColor(frames.last().image(), squareCount - 1)
+                        == QColor(colors[squareCount - 1]));
+    for (int j = 0; j < squareCount; ++j) {
+        QCOMPARE(squareColor(frames.last().image(), j), QColor(colors[j]));
+        QCOMPARE(squareColor(kept, j), QColor(0x80, 0x80, 0x80));
+    }
+    page.stopFrameCapture();
+}
+
+int main(int argc, char *argv[])
+{
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Software);
+    qputenv("QTWEBENGINE_RASTER_WIDGETS", "1");
+    QList<const char *> w_argv(argv, argv + argc);
+    w_argv.append("--webEngineArgs");
+    w_argv.append("--disable-gpu");
+    int w_argc = w_argv.size();
+
+    QApplication app(w_argc, const_cast<char **>(w_argv.data()));
+    app.setAttribute(Qt::AA_Use96Dpi, true);
+    tst_SoftwareCompositor tc;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_softwarecompositor.moc"
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <httpserver.h>
+#include <quickutil.h>
+
+#include <QtTest/QtTest>
+#include <QQuickView>
+#include <QtWebEngineCore/qwebenginecompositorstatistics.h>
+#include <QtWebEngineQuick/qtwebenginequickglobal.h>
+#include <QtWebEngineQuick/private/qquickwebengineview_p.h>
+
+#include <ctime>
+
+// Measures the software compositor path: frames presented per second, CPU
+// time of the browser process per frame, and an estimate of the bytes of
+// frame data uploaded per frame.
+//
+// std::clock() only covers the browser process, which runs the compositor
+// and the Qt side; the renderer and GPU processes are not included. The
+// upload estimate is the damaged area at four bytes per pixel. It leaves out
+// the stale regions BeginPaint() copies between buffers, and overcounts
+// damage that overlaps between frames merged into one presented frame.
+class tst_bench_QQuickWebEngineViewRendering : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void rendering_data();
+    void rendering();
+
+private:
+    HttpServer m_server;
+};
+
+// How long frames are counted after warming up.
+static constexpr int kMeasureMilliseconds = 5000;
+static constexpr int kWarmUpMilliseconds = 1000;
+
+void tst_bench_QQuickWebEngineViewRendering::initTestCase()
+{
+    m_server.setResourceDirs({ QStringLiteral(":/data") });
+    QVERIFY(m_server.start());
+}
+
+void tst_bench_QQuickWebEngineViewRendering::cleanupTestCase()
+{
+    QVERIFY(m_server.stop());
+}
+
+void tst_bench_QQuickWebEngineViewRendering::rendering_data()
+{
+    QTest::addColumn<QString>("page");
+
+    QTest::newRow("scroll") << QStringLiteral("/scroll.html");
+    QTest::newRow("animation") << QStringLiteral("/animation.html");
+    QTest::newRow("canvas") << QStringLiteral("/canvas.html");
+    QTest::newRow("caret") << QStringLiteral("/caret.html");
+}
+
+void tst_bench_QQuickWebEngineViewRendering::rendering()
+{
+    QFETCH(QString, page);
+
+    QQuickView view;
+    view.setSource(QUrl(QStringLiteral("data:text/plain,%1")
+                                .arg(QUrl::toPercentEncoding(QStringLiteral(
+                                        "import QtQuick; import QtWebEngine; "
+                                        "WebEngineView { width: 1024; height: 768 }")))));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    auto *webEngineView = static_cast<QQuickWebEngineView *>(view.rootObject());
+    webEngineView->setUrl(m_server.url(page));
+    QVERIFY(waitForLoadSucceeded(webEngineView));
+    QTest::qWait(kWarmUpMilliseconds);
+
+    webEngineView->resetCompositorStatistics();
+    const std::clock_t cpuStart = std::clock();
+    QElapsedTimer timer;
+    timer.start();
+    QTest::qWait(kMeasureMilliseconds);
+    const qint64 elapsed = timer.nsecsElapsed();
+    const std::clock_t cpuTime = std::clock() - cpuStart;
+    const QWebEngineCompositorStatistics statistics = webEngineView->compositorStatistics();
+
+    QVERIFY(statistics.framesPresented() > 0);
+    const qreal framesPerSecond = statistics.framesPresented() * 1e9 / elapsed;
+    const qreal cpuMillisecondsPerFrame =
+            cpuTime * 1000.0 / CLOCKS_PER_SEC / statistics.framesPresented();
+    const qreal estimatedBytesPerFrame =
+            statistics.damagedPixelArea() * 4.0 / statistics.framesPresented();
+
+    qInfo("%s: %.1f fps, %.2f ms browser process CPU/frame, ~%.0f bytes damaged/frame (estimate), "
+          "%llu of %llu frames dropped",
+          qPrintable(page), framesPerSecond, cpuMillisecondsPerFrame, estimatedBytesPerFrame,
+          statistics.framesDropped(), statistics.framesProduced());
+    QTest::setBenchmarkResult(framesPerSecond, QTest::FramesPerSecond);
+}
+
+int main(int argc, char *argv[])
+{
+    // Benchmark the software compositor without a display by default.
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QtWebEngineQuick::initialize();
+    QList<const char *> w_argv(argv, argv + argc);
+    w_argv.append("--webEngineArgs");
+    w_argv.append("--disable-gpu");
+    int w_argc = w_argv.size();
+
+    QGuiApplication app(w_argc, const_cast<char **>(w_argv.data()));
+    tst_bench_QQuickWebEngineViewRendering tc;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_bench_qquickwebengineviewrendering.moc"
+#include "moc_quickutil.cpp"